@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLCell.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCell.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCell.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLCellIterator.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellIterator.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellIterator.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLCellRange.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellRange.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellRange.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLCellReference.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellReference.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellReference.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLCellValue.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellValue.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLCellValue.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLColor.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLColor.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLColor.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLColumn.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLColumn.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLColumn.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLComments.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLComments.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLComments.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLContentTypes.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLContentTypes.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLContentTypes.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLDateTime.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDateTime.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDateTime.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLDocument.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDocument.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDocument.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLDrawing.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDrawing.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLDrawing.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLFormula.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLFormula.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLFormula.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLMergeCells.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLMergeCells.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLMergeCells.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLProperties.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLProperties.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLProperties.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLRelationships.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRelationships.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRelationships.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLRow.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRow.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRow.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLRowData.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRowData.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRowData.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLRowIndex.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRowIndex.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLRowIndex.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLSharedStrings.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLSharedStrings.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLSharedStrings.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLSheet.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLSheet.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLSheet.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLStreamingSheetReader.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetReader.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetReader.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLStreamingSheetWriter.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetWriter.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetWriter.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLStyles.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStyles.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLStyles.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLTables.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLTables.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLTables.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLTrace.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLTrace.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLTrace.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLWorkbook.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLWorkbook.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLWorkbook.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLXmlData.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlData.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlData.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLXmlFile.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlFile.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlFile.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLXmlParser.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlParser.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLXmlParser.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/OpenXLSX/sources/XLZipArchive.cpp" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLZipArchive.cpp.o" "gcc" "OpenXLSX/CMakeFiles/OpenXLSX.dir/sources/XLZipArchive.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "../output/libOpenXLSX.a"
+  "../output/libOpenXLSX.pdb"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCell.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCell.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellIterator.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellIterator.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellRange.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellRange.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellReference.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellReference.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellValue.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLCellValue.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLColor.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLColor.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLColumn.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLColumn.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLComments.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLComments.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLContentTypes.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLContentTypes.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDateTime.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDateTime.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDocument.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDocument.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDrawing.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLDrawing.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLFormula.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLFormula.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLMergeCells.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLMergeCells.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLProperties.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLProperties.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRelationships.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRelationships.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRow.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRow.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRowData.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRowData.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRowIndex.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLRowIndex.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLSharedStrings.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLSharedStrings.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLSheet.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLSheet.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetReader.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetReader.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetWriter.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStreamingSheetWriter.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStyles.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLStyles.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLTables.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLTables.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLTrace.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLTrace.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLWorkbook.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLWorkbook.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlData.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlData.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlFile.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlFile.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlParser.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLXmlParser.cpp.o.d"
+  "CMakeFiles/OpenXLSX.dir/sources/XLZipArchive.cpp.o"
+  "CMakeFiles/OpenXLSX.dir/sources/XLZipArchive.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenXLSX.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
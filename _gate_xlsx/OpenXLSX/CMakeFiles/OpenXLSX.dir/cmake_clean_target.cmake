@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "../output/libOpenXLSX.a"
+)
@@ -0,0 +1 @@
+include("${CMAKE_CURRENT_LIST_DIR}/OpenXLSXTargets.cmake")
\ No newline at end of file
@@ -0,0 +1,127 @@
+# Install script for directory: /root/repo/extlib/OpenXLSX/OpenXLSX
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/OpenXLSX/headers" TYPE FILE FILES "/root/repo/_gate_xlsx/OpenXLSX/OpenXLSX-Exports.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/OpenXLSX/headers" TYPE FILE FILES
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/IZipArchive.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCell.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCellIterator.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCellRange.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCellReference.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCellValue.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLColor.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLColumn.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLCommandQuery.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLComments.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLConstants.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLContentTypes.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLDateTime.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLDocument.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLDrawing.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLException.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLFormula.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLIterator.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLMergeCells.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLProperties.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLRelationships.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLRow.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLRowData.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLRowIndex.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLSharedStrings.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLSheet.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLStreamingSheetReader.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLStreamingSheetWriter.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLStyles.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLTables.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLTrace.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLWorkbook.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLXmlData.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLXmlFile.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLXmlParser.hpp"
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/headers/XLZipArchive.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/OpenXLSX" TYPE FILE FILES "/root/repo/extlib/OpenXLSX/OpenXLSX/OpenXLSX.hpp")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "lib" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_gate_xlsx/output/libOpenXLSX.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX" TYPE FILE FILES
+    "/root/repo/extlib/OpenXLSX/OpenXLSX/OpenXLSXConfig.cmake"
+    "/root/repo/_gate_xlsx/OpenXLSX/OpenXLSX/OpenXLSXConfigVersion.cmake"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX/OpenXLSXTargets.cmake")
+    file(DIFFERENT _cmake_export_file_changed FILES
+         "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX/OpenXLSXTargets.cmake"
+         "/root/repo/_gate_xlsx/OpenXLSX/CMakeFiles/Export/c72cc94553a1a0c9b05f75dae42fb1d7/OpenXLSXTargets.cmake")
+    if(_cmake_export_file_changed)
+      file(GLOB _cmake_old_config_files "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX/OpenXLSXTargets-*.cmake")
+      if(_cmake_old_config_files)
+        string(REPLACE ";" ", " _cmake_old_config_files_text "${_cmake_old_config_files}")
+        message(STATUS "Old export file \"$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX/OpenXLSXTargets.cmake\" will be replaced.  Removing files [${_cmake_old_config_files_text}].")
+        unset(_cmake_old_config_files_text)
+        file(REMOVE ${_cmake_old_config_files})
+      endif()
+      unset(_cmake_old_config_files)
+    endif()
+    unset(_cmake_export_file_changed)
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX" TYPE FILE FILES "/root/repo/_gate_xlsx/OpenXLSX/CMakeFiles/Export/c72cc94553a1a0c9b05f75dae42fb1d7/OpenXLSXTargets.cmake")
+  if(CMAKE_INSTALL_CONFIG_NAME MATCHES "^([Rr][Ee][Ll][Ee][Aa][Ss][Ee])$")
+    file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/cmake/OpenXLSX" TYPE FILE FILES "/root/repo/_gate_xlsx/OpenXLSX/CMakeFiles/Export/c72cc94553a1a0c9b05f75dae42fb1d7/OpenXLSXTargets-release.cmake")
+  endif()
+endif()
+
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/extlib/OpenXLSX/Tests/main.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/main.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/main.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLCell.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCell.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCell.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLCellRange.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellRange.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellRange.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLCellReference.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellReference.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellReference.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLCellValue.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellValue.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellValue.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLCellValueProxy.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellValueProxy.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLCellValueProxy.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLColor.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLColor.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLColor.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLDateTime.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLDateTime.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLDateTime.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLDocument.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLDocument.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLDocument.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLFormula.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLFormula.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLFormula.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLRow.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLRow.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLRow.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLRowIndex.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLRowIndex.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLRowIndex.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLSharedStrings.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLSharedStrings.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLSharedStrings.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLSheet.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLSheet.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLSheet.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLStreamingSheetReader.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetReader.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetReader.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLStreamingSheetWriter.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetWriter.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetWriter.cpp.o.d"
+  "/root/repo/extlib/OpenXLSX/Tests/testXLStyles.cpp" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStyles.cpp.o" "gcc" "Tests/CMakeFiles/OpenXLSXTests.dir/testXLStyles.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_xlsx/OpenXLSX/CMakeFiles/OpenXLSX.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
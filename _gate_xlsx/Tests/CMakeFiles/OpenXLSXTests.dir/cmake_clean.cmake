@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "../output/OpenXLSXTests"
+  "../output/OpenXLSXTests.pdb"
+  "CMakeFiles/OpenXLSXTests.dir/main.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/main.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCell.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCell.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellRange.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellRange.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellReference.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellReference.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellValue.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellValue.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellValueProxy.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLCellValueProxy.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLColor.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLColor.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLDateTime.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLDateTime.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLDocument.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLDocument.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLFormula.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLFormula.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLRow.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLRow.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLRowIndex.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLRowIndex.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLSharedStrings.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLSharedStrings.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLSheet.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLSheet.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetReader.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetReader.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetWriter.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStreamingSheetWriter.cpp.o.d"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStyles.cpp.o"
+  "CMakeFiles/OpenXLSXTests.dir/testXLStyles.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/OpenXLSXTests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,92 @@
+// Output size and speed of the get_sheet_range_content encodings.
+// Each run reports the encoded size in bytes and its ratio to the default json rows output.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "RangeSerializer.h"
+
+using ExcelWrapper::RangeSerializer;
+using OpenXLSX::XLCellValue;
+
+namespace {
+
+constexpr uint32_t ROWS = 1000;
+constexpr uint32_t COLUMNS = 20;
+
+// A typical table: id, category, amount, flag and free text columns, every cell filled
+RangeSerializer::Rows denseRange()
+{
+    static const char* CATEGORIES[] = {"North", "South", "East", "West"};
+    RangeSerializer::Rows rows(ROWS, std::vector<XLCellValue>(COLUMNS));
+    for (uint32_t r = 0; r < ROWS; ++r) {
+        for (uint32_t c = 0; c < COLUMNS; ++c) {
+            switch (c % 5) {
+                case 0: rows[r][c] = XLCellValue(static_cast<int64_t>(r * COLUMNS + c)); break;
+                case 1: rows[r][c] = XLCellValue(std::string(CATEGORIES[(r + c) % 4])); break;
+                case 2: rows[r][c] = XLCellValue(r * 1.25 + c); break;
+                case 3: rows[r][c] = XLCellValue((r + c) % 2 == 0); break;
+                default: rows[r][c] = XLCellValue("Note " + std::to_string(r) + "/" + std::to_string(c)); break;
+            }
+        }
+    }
+    return rows;
+}
+
+// The same table with only one cell in ten filled
+RangeSerializer::Rows sparseRange()
+{
+    RangeSerializer::Rows rows = denseRange();
+    for (uint32_t r = 0; r < ROWS; ++r) {
+        for (uint32_t c = 0; c < COLUMNS; ++c) {
+            if ((r * 7 + c * 3) % 10 != 0) rows[r][c] = XLCellValue();
+        }
+    }
+    return rows;
+}
+
+void encode(benchmark::State& state, const RangeSerializer::Rows& rows, RangeSerializer::Format format)
+{
+    RangeSerializer serializer("?");
+    const double baseline = static_cast<double>(serializer.rowsToJson(rows).size());
+    size_t bytes = 0;
+    for (auto _ : state) {
+        std::string text = serializer.serialize(format, rows, 1, 1);
+        bytes = text.size();
+        benchmark::DoNotOptimize(text);
+    }
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.counters["vs_json"] = static_cast<double>(bytes) / baseline;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+void BM_Dense(benchmark::State& state, RangeSerializer::Format format)
+{
+    static const RangeSerializer::Rows rows = denseRange();
+    encode(state, rows, format);
+}
+
+void BM_Sparse(benchmark::State& state, RangeSerializer::Format format)
+{
+    static const RangeSerializer::Rows rows = sparseRange();
+    encode(state, rows, format);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Dense, json, RangeSerializer::Format::Json);
+BENCHMARK_CAPTURE(BM_Dense, cells, RangeSerializer::Format::Cells);
+BENCHMARK_CAPTURE(BM_Dense, csv, RangeSerializer::Format::Csv);
+BENCHMARK_CAPTURE(BM_Dense, tsv, RangeSerializer::Format::Tsv);
+BENCHMARK_CAPTURE(BM_Dense, markdown, RangeSerializer::Format::Markdown);
+BENCHMARK_CAPTURE(BM_Dense, columnar, RangeSerializer::Format::Columnar);
+BENCHMARK_CAPTURE(BM_Dense, auto, RangeSerializer::Format::Auto);
+
+BENCHMARK_CAPTURE(BM_Sparse, json, RangeSerializer::Format::Json);
+BENCHMARK_CAPTURE(BM_Sparse, cells, RangeSerializer::Format::Cells);
+BENCHMARK_CAPTURE(BM_Sparse, csv, RangeSerializer::Format::Csv);
+BENCHMARK_CAPTURE(BM_Sparse, tsv, RangeSerializer::Format::Tsv);
+BENCHMARK_CAPTURE(BM_Sparse, markdown, RangeSerializer::Format::Markdown);
+BENCHMARK_CAPTURE(BM_Sparse, columnar, RangeSerializer::Format::Columnar);
+BENCHMARK_CAPTURE(BM_Sparse, auto, RangeSerializer::Format::Auto);
@@ -41,6 +41,36 @@ static void BM_WriteStrings(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_WriteStrings)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Write only unique strings, so that every assignment looks up (and then appends to) an ever growing shared
+ * strings table. The argument is the number of rows; the largest run produces 512k unique strings.
+ * @param state
+ */
+static void BM_WriteStringsHighCardinality(benchmark::State& state)    // NOLINT
+{
+    XLDocument doc;
+    doc.create("./benchmark_strings_unique.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    const auto               uniqueRows = static_cast<uint32_t>(state.range(0));
+    std::vector<XLCellValue> values(colCount);
+    uint64_t                 counter = 0;
+
+    for (auto _ : state)    // NOLINT
+        for (auto& row : wks.rows(uniqueRows)) {
+            for (auto& value : values) value = "OpenXLSX " + std::to_string(counter++);
+            row.values() = values;
+        }
+
+    state.SetItemsProcessed(counter);
+    state.counters["items"] = state.items_processed();
+
+    doc.save();
+    doc.close();
+}
+
+BENCHMARK(BM_WriteStringsHighCardinality)->Arg(1024)->Arg(8192)->Arg(65536)->Unit(benchmark::kMillisecond);    // NOLINT
+
 /**
  * @brief
  * @param state
@@ -179,6 +209,39 @@ static void BM_ReadIntegers(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_ReadIntegers)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Reads the same data as BM_ReadIntegers, with a streaming reader instead of the worksheet DOM. Unlike
+ * BM_ReadIntegers, every iteration includes inflating and tokenizing the worksheet XML.
+ * @param state
+ */
+static void BM_ReadIntegersStreaming(benchmark::State& state)    // NOLINT
+{
+    XLDocument doc;
+    doc.open("./benchmark_integers.xlsx");
+    uint64_t result = 0;
+    std::vector<XLCellValue> values;
+
+    for (auto _ : state) {    // NOLINT
+        auto reader = doc.workbook().worksheetReader("Sheet1");
+        while (reader.nextRow(values) != 0) {
+            result += std::accumulate(values.begin(),
+                                      values.end(),
+                                      0,
+                                      [](uint64_t a, XLCellValue& b) { return a + b.get<uint64_t>(); });
+        }
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(rowCount * colCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.close();
+}
+
+BENCHMARK(BM_ReadIntegersStreaming)->Unit(benchmark::kMillisecond);    // NOLINT
+
 /**
  * @brief
  * @param state
@@ -246,4 +309,137 @@ static void BM_ReadBools(benchmark::State& state)    // NOLINT
 
 BENCHMARK(BM_ReadBools)->Unit(benchmark::kMillisecond);    // NOLINT
 
+/**
+ * @brief Random cell(row, column) access in rows spanning all MAX_COLS columns. Every lookup walks up to half a row
+ * of sibling cells, so this measures the cost of decoding the column of each cell node that is skipped.
+ * @param state
+ */
+static void BM_ReadWideRows(benchmark::State& state)    // NOLINT
+{
+    constexpr uint32_t wideRowCount = 16;
+
+    XLDocument doc;
+    doc.create("./benchmark_wide_rows.xlsx");
+    auto wks = doc.workbook().worksheet("Sheet1");
+
+    std::vector<XLCellValue> values(MAX_COLS, 42);
+    for (auto& row : wks.rows(wideRowCount)) row.values() = values;
+
+    uint64_t result = 0;
+    uint16_t column = 1;
+    for (auto _ : state) {    // NOLINT
+        for (uint32_t row = 1; row <= wideRowCount; ++row) {
+            column = static_cast<uint16_t>(column * 7919 % MAX_COLS + 1);    // scatter accesses over the whole row
+            result += wks.cell(row, column).value().get<int64_t>();
+        }
+
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * wideRowCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.close();
+}
+
+BENCHMARK(BM_ReadWideRows)->Unit(benchmark::kMicrosecond);    // NOLINT
+
+/**
+ * @brief Save a workbook in which every sheet was modified, deflating the sheets on state.range(0) threads.
+ * @param state
+ */
+static void BM_SaveMultiSheet(benchmark::State& state)    // NOLINT
+{
+    constexpr uint32_t sheetCount    = 16;
+    constexpr uint32_t sheetRowCount = 20000;
+
+    XLDocument doc;
+    doc.create("./benchmark_save.xlsx", XLForceOverwrite);
+    for (uint32_t i = 2; i <= sheetCount; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+
+    std::vector<XLCellValue> values(colCount, 42);
+    for (auto& name : doc.workbook().worksheetNames()) {
+        auto wks = doc.workbook().worksheet(name);
+        for (auto& row : wks.rows(sheetRowCount)) row.values() = values;
+    }
+
+    XLZipSaveOptions options;
+    options.compressionThreads = static_cast<unsigned int>(state.range(0));
+
+    int64_t counter = 0;
+    for (auto _ : state) {    // NOLINT
+        state.PauseTiming();
+        for (auto& name : doc.workbook().worksheetNames()) doc.workbook().worksheet(name).cell("A1").value() = ++counter;    // mark all sheets modified
+        state.ResumeTiming();
+
+        doc.save(options);
+    }
+
+    state.SetItemsProcessed(state.iterations() * sheetCount);
+    state.counters["items"] = state.items_processed();
+
+    doc.close();
+}
+
+BENCHMARK(BM_SaveMultiSheet)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Generate and save a workbook of state.range(0) mixed-type rows through the worksheet DOM.
+ * @param state
+ */
+static void BM_GenerateRowsDom(benchmark::State& state)    // NOLINT
+{
+    const auto rows = static_cast<uint32_t>(state.range(0));
+
+    for (auto _ : state) {    // NOLINT
+        XLDocument doc;
+        doc.create("./benchmark_generate.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        for (uint32_t r = 1; r <= rows; ++r) {
+            wks.cell(r, 1).value() = static_cast<int64_t>(r);
+            wks.cell(r, 2).value() = r / 3.0;
+            wks.cell(r, 3).value() = "Item " + std::to_string(r % 1000);
+        }
+        doc.save();
+        doc.close();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+    state.counters["items"] = state.items_processed();
+}
+
+BENCHMARK(BM_GenerateRowsDom)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);    // NOLINT
+
+/**
+ * @brief Generate the same workbook as BM_GenerateRowsDom with a streaming sheet writer. Up to the worksheet's row
+ * limit, memory use grows with the compressed sheet size only.
+ * @param state
+ */
+static void BM_GenerateRowsStreaming(benchmark::State& state)    // NOLINT
+{
+    const auto rows = static_cast<uint32_t>(state.range(0));
+
+    for (auto _ : state) {    // NOLINT
+        XLDocument doc;
+        doc.create("./benchmark_generate.xlsx", XLForceOverwrite);
+        auto writer = doc.workbook().worksheetWriter("Sheet1");
+        std::vector<XLCellValue> values(3);
+        for (uint32_t r = 1; r <= rows; ++r) {
+            values[0] = static_cast<int64_t>(r);
+            values[1] = r / 3.0;
+            values[2] = "Item " + std::to_string(r % 1000);
+            writer.appendRow(values);
+        }
+        writer.close();
+        doc.save();
+        doc.close();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rows);
+    state.counters["items"] = state.items_processed();
+}
+
+BENCHMARK(BM_GenerateRowsStreaming)->Arg(100000)->Arg(1000000)->Arg(rowCount)->Unit(benchmark::kMillisecond);    // NOLINT
+
 #pragma warning(pop)
@@ -57,6 +57,9 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "headers/XLFormula.hpp"
 #include "headers/XLRow.hpp"
 #include "headers/XLSheet.hpp"
+#include "headers/XLStreamingSheetReader.hpp"
+#include "headers/XLStreamingSheetWriter.hpp"
+#include "headers/XLTrace.hpp"
 #include "headers/XLWorkbook.hpp"
 #include "headers/XLZipArchive.hpp"
 
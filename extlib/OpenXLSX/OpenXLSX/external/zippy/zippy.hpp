@@ -15,14 +15,17 @@
 #endif // _MSC_VER
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <random>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifdef _WIN32
@@ -9901,6 +9904,17 @@ namespace Zippy
 
     namespace Impl
     {
+        /**
+         * @brief The result of deflating the data of a modified entry ahead of writing it to the archive.
+         */
+        struct DeflatedData
+        {
+            ZipEntryData Data {};             /**< The raw deflate stream (no zlib header). */
+            mz_uint32    Crc32 {};            /**< The CRC-32 of the uncompressed data. */
+            mz_uint64    UncompressedSize {}; /**< The size of the uncompressed data. */
+            bool         IsValid {false};     /**< false if the entry was not deflated. */
+        };
+
         /**
          * @brief The Impl::ZipEntry class implements the functionality required for manipulating entries in a zip archive.
          * @details This is the implementation class. The ZipEntry class in the Zippy namespace implements the public interface.
@@ -10035,6 +10049,7 @@ namespace Zippy
                 }
 
                 m_EntryData  = result;
+                m_Deflated   = DeflatedData();
                 m_IsModified = true;
             }
 
@@ -10045,6 +10060,7 @@ namespace Zippy
             void SetData(const ZipEntryData& data)
             {
                 m_EntryData  = data;
+                m_Deflated   = DeflatedData();
                 m_IsModified = true;
             }
 
@@ -10147,6 +10163,7 @@ namespace Zippy
         private:
             ZipEntryInfo m_EntryInfo = ZipEntryInfo(); /**< The zip entry metadata. */
             ZipEntryData m_EntryData = ZipEntryData(); /**< The zip entry data. */
+            DeflatedData m_Deflated  = DeflatedData(); /**< The data of an entry written with a ZipEntryWriter, kept deflated until it is saved. */
 
             bool m_IsModified = false; /**< Boolean flag indicating if the file has been modified since opening. */
 
@@ -10818,10 +10835,21 @@ namespace Zippy
         /**
          * @brief Save the archive with a new name. The original archive will remain unchanged.
          * @param filename The new filename.
+         * @param compressionThreads The number of threads used for deflating modified entries. 0 uses one thread per
+         * hardware thread; 1 deflates each entry while writing it, on the calling thread.
+         * @param compressionLevel Returns the deflate level (0 = store, up to 10) for a modified entry, given its name.
+         * If empty, all modified entries are compressed with MZ_DEFAULT_LEVEL.
+         * @param fullValidation If true, the written archive is validated by mz_zip_validate_file_archive, which reads and
+         * inflates every entry, and the archive is then reopened. If false, only the central directory is read back and
+         * compared to the one held in memory while writing (it holds the CRC-32 and sizes computed for every entry), and the
+         * entries switch to the new file without a reopen.
          * @note If no filename is provided, the file will be saved with the existing name, overwriting any existing data.
          * @throws ZipException A ZipException object is thrown if calls to miniz function fails.
          */
-        void Save(std::string filename = "")
+        void Save(std::string                                          filename           = "",
+                  unsigned int                                         compressionThreads = 1,
+                  const std::function<unsigned int(const std::string&)>& compressionLevel = {},
+                  bool                                                 fullValidation     = true)
         {
             if (!IsOpen()) throw ZipLogicError("Cannot call Save on empty ZipArchive object!");
 
@@ -10854,8 +10882,19 @@ namespace Zippy
             if (!mz_zip_writer_init_file(&tempArchive, tempPath.c_str(), 0))              // pull request #210
                 throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error)); //  "
 
+            // ===== Determine the compression level of each modified entry
+            std::vector<mz_uint> levels(m_ZipEntries.size(), MZ_DEFAULT_LEVEL);
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                if (compressionLevel && m_ZipEntries[i].IsModified())
+                    levels[i] = std::min<mz_uint>(compressionLevel(m_ZipEntries[i].GetName()), MZ_UBER_COMPRESSION);
+            }
+
+            // ===== Deflate the modified entries up front if several threads were requested
+            std::vector<Impl::DeflatedData> deflated = DeflateModifiedEntries(compressionThreads, levels);
+
             // ===== Iterate through the ZipEntries and add entries to the temporary file
-            for (auto& file : m_ZipEntries) {
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                auto& file = m_ZipEntries[i];
                 if (file.IsDirectory()) continue;    // TODO: Ensure this is the right thing to do (Excel issue)
                 if (!file.IsModified()) {
                     if (!mz_zip_writer_add_from_zip_reader(&tempArchive, &m_Archive, file.Index())) {
@@ -10863,32 +10902,114 @@ namespace Zippy
                     }
                 }
 
+                else if (file.m_Deflated.IsValid) {
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  file.m_Deflated.Data.data(),
+                                                  file.m_Deflated.Data.size(),
+                                                  nullptr,
+                                                  0,
+                                                  MZ_DEFAULT_LEVEL | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                                  file.m_Deflated.UncompressedSize,
+                                                  file.m_Deflated.Crc32)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                }
+
+                else if (i < deflated.size() && deflated[i].IsValid) {
+                    if (!mz_zip_writer_add_mem_ex(&tempArchive,
+                                                  file.GetName().c_str(),
+                                                  deflated[i].Data.data(),
+                                                  deflated[i].Data.size(),
+                                                  nullptr,
+                                                  0,
+                                                  levels[i] | MZ_ZIP_FLAG_COMPRESSED_DATA,
+                                                  file.m_EntryData.size(),
+                                                  deflated[i].Crc32)) {
+                        throw ZipRuntimeError(mz_zip_get_error_string(tempArchive.m_last_error));
+                    }
+                }
+
                 else {
                     if (!mz_zip_writer_add_mem(&tempArchive,
                                                file.GetName().c_str(),
                                                file.m_EntryData.data(),
                                                file.m_EntryData.size(),
-                                               MZ_DEFAULT_COMPRESSION)) {
+                                               levels[i])) {
                         throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
                     }
                 }
             }
 
-            // ===== Finalize and close the temporary archive
+            // ===== Finalize and close the temporary archive, keeping a copy of the central directory that was written
             mz_zip_writer_finalize_archive(&tempArchive);
+            const auto* centralDir = static_cast<const unsigned char*>(tempArchive.m_pState->m_central_dir.m_p);
+            ZipEntryData writtenCentralDir;
+            if (!fullValidation) writtenCentralDir.assign(centralDir, centralDir + tempArchive.m_pState->m_central_dir.m_size);
             mz_zip_writer_end(&tempArchive);
 
-            // ===== Validate the temporary file
-            mz_zip_error errordata;
-            if (!mz_zip_validate_file_archive(tempPath.c_str(), 0, &errordata)) {
-                throw ZipRuntimeError(mz_zip_get_error_string(errordata));
+            if (fullValidation) {
+                // ===== Validate the temporary file
+                mz_zip_error errordata;
+                if (!mz_zip_validate_file_archive(tempPath.c_str(), 0, &errordata)) {
+                    throw ZipRuntimeError(mz_zip_get_error_string(errordata));
+                }
+
+                // ===== Close the current archive, delete the file with input filename (if it exists), rename the temporary and call Open.
+                Close();
+                MZ_DELETE_FILE(filename.c_str());
+                MZ_RENAME_FILE(tempPath.c_str(), filename.c_str());
+                Open(filename);
+                return;
             }
 
-            // ===== Close the current archive, delete the file with input filename (if it exists), rename the temporary and call Open.
-            Close();
+            // ===== Read the central directory of the temporary file into the reader (miniz checks its consistency) and
+            //       compare it to the one that was written. The reader of the current file is no longer needed.
+            mz_zip_reader_end(&m_Archive);
+            m_Archive         = mz_zip_archive();
+            bool isConsistent = mz_zip_reader_init_file(&m_Archive, tempPath.c_str(), 0);
+            if (isConsistent) {
+                const auto& readCentralDir = m_Archive.m_pState->m_central_dir;
+                isConsistent = readCentralDir.m_size == writtenCentralDir.size() &&
+                               std::equal(writtenCentralDir.begin(), writtenCentralDir.end(), static_cast<const unsigned char*>(readCentralDir.m_p));
+                if (!isConsistent) mz_zip_reader_end(&m_Archive);
+            }
+            if (!isConsistent) {
+                std::string error = mz_zip_get_error_string(m_Archive.m_last_error);
+                MZ_DELETE_FILE(tempPath.c_str());
+                m_Archive = mz_zip_archive();    // fall back to the unchanged current file, so that the save can be retried
+                if (!mz_zip_reader_init_file(&m_Archive, m_ArchivePath.c_str(), 0)) m_IsOpen = false;
+                throw ZipRuntimeError("Validation of the saved archive failed: " + error);
+            }
+
+            // ===== Delete the file with input filename (if it exists) and rename the temporary. On Windows, an open file can not
+            //       be renamed, so the reader is re-initialized from the central directory of the renamed file.
+#           ifdef _WIN32
+                mz_zip_reader_end(&m_Archive);
+#           endif
             MZ_DELETE_FILE(filename.c_str());
             MZ_RENAME_FILE(tempPath.c_str(), filename.c_str());
-            Open(filename);
+            m_ArchivePath = filename;
+#           ifdef _WIN32
+                m_Archive = mz_zip_archive();
+                if (!mz_zip_reader_init_file(&m_Archive, m_ArchivePath.c_str(), 0)) {
+                    m_IsOpen = false;
+                    throw ZipRuntimeError(std::string(mz_zip_get_error_string(m_Archive.m_last_error)) + " (m_ArchivePath: " + m_ArchivePath + ")");
+                }
+#           endif
+
+            // ===== The entries were written in order, skipping directories: update their metadata (index, sizes) from the new
+            //       file. Modified data now lives in the archive and is extracted again on demand.
+            mz_uint fileIndex = 0;
+            for (auto& file : m_ZipEntries) {
+                if (file.IsDirectory()) continue;
+                mz_zip_reader_file_stat(&m_Archive, fileIndex++, &file.m_EntryInfo);
+                if (file.m_IsModified) {
+                    file.m_IsModified = false;
+                    file.m_EntryData  = ZipEntryData();
+                    file.m_Deflated   = Impl::DeflatedData();
+                }
+            }
         }
 
         /**
@@ -10930,6 +11051,9 @@ namespace Zippy
                 return name == entry.GetName();
             });
 
+            // ===== Data written with a ZipEntryWriter is inflated on first access.
+            if (result->m_Deflated.IsValid) InflateEntry(*result);
+
             // ===== If data has not been extracted from the archive (i.e., m_EntryData is empty),
             // ===== extract the data from the archive to the ZipEntry object.
             if (result->m_EntryData.empty()) {
@@ -10949,6 +11073,44 @@ namespace Zippy
             return ZipEntry(&*result);
         }
 
+        /**
+         * @brief Open the entry with the specified name for reading its data in chunks, without extracting the whole entry
+         * into memory.
+         * @details Entries stored in the archive, and entries written with a ZipEntryWriter, are inflated incrementally, using
+         * buffers of constant size. Other modified entries are read from a copy of their data.
+         * @param name The name of the entry in the archive.
+         * @return A function that copies up to size bytes of the entry data into buffer and returns the number of bytes
+         * copied, or 0 once all data has been read.
+         * @warning The returned function must not be called after the archive has been closed or saved.
+         */
+        std::function<size_t(void*, size_t)> GetEntryStream(const std::string& name)
+        {
+            if (!IsOpen()) throw ZipLogicError("Cannot call GetEntryStream on empty ZipArchive object!");
+
+            // ===== Look up ZipEntry object.
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            if (result == m_ZipEntries.end()) throw ZipLogicError("Entry " + name + " does not exist in the archive!");
+
+            if (result->m_Deflated.IsValid) return GetInflatingStream(result->m_Deflated);
+
+            if (result->IsModified()) {
+                auto data = std::make_shared<ZipEntryData>(result->m_EntryData);
+                return [data, pos = size_t {0}](void* buffer, size_t size) mutable {
+                    const size_t count = std::min(size, data->size() - pos);
+                    std::copy_n(data->data() + pos, count, static_cast<unsigned char*>(buffer));
+                    pos += count;
+                    return count;
+                };
+            }
+
+            auto* iterator = mz_zip_reader_extract_iter_new(&m_Archive, result->Index(), 0);
+            if (iterator == nullptr) throw ZipRuntimeError(mz_zip_get_error_string(m_Archive.m_last_error));
+            std::shared_ptr<mz_zip_reader_extract_iter_state> state(iterator, mz_zip_reader_extract_iter_free);
+            return [state](void* buffer, size_t size) { return mz_zip_reader_extract_iter_read(state.get(), buffer, size); };
+        }
+
         /**
          * @brief Extract the entry with the provided name to the destination path.
          * @param name The name of the entry to extract.
@@ -11089,12 +11251,246 @@ namespace Zippy
         }
 
     private:
+        friend class ZipEntryWriter;
+
+        /**
+         * @brief Replace the data of an entry (adding the entry if it does not exist) with data that has already been deflated.
+         * @param name The name of the entry.
+         * @param data The raw deflate stream of the data, with its CRC-32 and uncompressed size.
+         */
+        void AddDeflatedEntry(const std::string& name, Impl::DeflatedData data)
+        {
+            AddEntryImpl(name, ZipEntryData());
+            auto result = std::find_if(m_ZipEntries.begin(), m_ZipEntries.end(), [&](const Impl::ZipEntry& entry) {
+                return name == entry.GetName();
+            });
+            result->m_Deflated = std::move(data);
+        }
+
+        /**
+         * @brief Inflate the data of an entry written with a ZipEntryWriter into its entry data.
+         * @param entry The entry.
+         */
+        static void InflateEntry(Impl::ZipEntry& entry)
+        {
+            entry.m_EntryData.resize(entry.m_Deflated.UncompressedSize);
+            const size_t size = tinfl_decompress_mem_to_mem(entry.m_EntryData.data(),
+                                                            entry.m_EntryData.size(),
+                                                            entry.m_Deflated.Data.data(),
+                                                            entry.m_Deflated.Data.size(),
+                                                            0);
+            if (size != entry.m_EntryData.size()) throw ZipRuntimeError("Failed to inflate entry " + entry.GetName());
+            entry.m_Deflated = Impl::DeflatedData();
+        }
+
+        /**
+         * @brief Get a stream that inflates a copy of the deflated data of an entry, in chunks of at most the dictionary size.
+         * @param deflated The deflated data.
+         * @return A function with the semantics of the one returned by GetEntryStream.
+         */
+        static std::function<size_t(void*, size_t)> GetInflatingStream(const Impl::DeflatedData& deflated)
+        {
+            struct InflateState
+            {
+                ZipEntryData       Input;
+                size_t             InputPos {};
+                tinfl_decompressor Inflator {};
+                ZipEntryData       Dictionary = ZipEntryData(TINFL_LZ_DICT_SIZE);
+                size_t             DictionaryPos {};    // write position in the (wrapping) dictionary
+                size_t             PendingPos {};       // first inflated byte not yet returned
+                size_t             Pending {};          // number of inflated bytes not yet returned
+                bool               IsDone {false};
+            };
+
+            auto state = std::make_shared<InflateState>();
+            state->Input = deflated.Data;
+            tinfl_init(&state->Inflator);
+
+            return [state](void* buffer, size_t size) {
+                size_t count = 0;
+                while (count < size) {
+                    if (state->Pending > 0) {
+                        const size_t chunk = std::min(state->Pending, size - count);
+                        std::copy_n(state->Dictionary.data() + state->PendingPos, chunk, static_cast<unsigned char*>(buffer) + count);
+                        state->PendingPos += chunk;
+                        state->Pending -= chunk;
+                        count += chunk;
+                        continue;
+                    }
+                    if (state->IsDone) break;
+
+                    size_t inputSize  = state->Input.size() - state->InputPos;
+                    size_t outputSize = TINFL_LZ_DICT_SIZE - state->DictionaryPos;
+                    const tinfl_status status = tinfl_decompress(&state->Inflator,
+                                                                 state->Input.data() + state->InputPos,
+                                                                 &inputSize,
+                                                                 state->Dictionary.data(),
+                                                                 state->Dictionary.data() + state->DictionaryPos,
+                                                                 &outputSize,
+                                                                 0);
+                    state->InputPos += inputSize;
+                    state->PendingPos    = state->DictionaryPos;
+                    state->Pending       = outputSize;
+                    state->DictionaryPos = (state->DictionaryPos + outputSize) & (TINFL_LZ_DICT_SIZE - 1);
+                    if (status < TINFL_STATUS_DONE) throw ZipRuntimeError("Failed to inflate entry data");
+                    state->IsDone = (status == TINFL_STATUS_DONE);
+                }
+                return count;
+            };
+        }
+
+        /**
+         * @brief Deflate the data of the modified entries on a pool of worker threads.
+         * @param threadCount The number of worker threads; 0 uses std::thread::hardware_concurrency().
+         * @param levels The deflate level of each entry in m_ZipEntries. Entries with level 0 are stored, and not deflated here.
+         * @return A vector parallel to m_ZipEntries with the raw deflate stream and CRC-32 of each modified entry, or an
+         * empty vector if fewer than two threads would be used. Entries that could not be deflated are marked as invalid,
+         * and are compressed by Save as usual.
+         */
+        std::vector<Impl::DeflatedData> DeflateModifiedEntries(unsigned int threadCount, const std::vector<mz_uint>& levels) const
+        {
+            if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+            std::vector<size_t> jobs;
+            for (size_t i = 0; i < m_ZipEntries.size(); ++i) {
+                const auto& file = m_ZipEntries[i];
+                if (file.IsModified() && !file.IsDirectory() && levels[i] > 0 && file.m_EntryData.size() > 3) jobs.push_back(i);    // miniz stores tiny entries
+            }
+            threadCount = static_cast<unsigned int>(std::min<size_t>(threadCount, jobs.size()));
+            if (threadCount < 2) return {};
+
+            // ===== Largest entries first, so that a big sheet does not end up last on a single thread
+            std::sort(jobs.begin(), jobs.end(), [&](size_t a, size_t b) {
+                return m_ZipEntries[a].m_EntryData.size() > m_ZipEntries[b].m_EntryData.size();
+            });
+
+            std::vector<Impl::DeflatedData> result(m_ZipEntries.size());
+            std::atomic<size_t>             nextJob {0};
+            auto                            worker = [&]() {
+                for (size_t job = nextJob++; job < jobs.size(); job = nextJob++) {
+                    const auto&   data  = m_ZipEntries[jobs[job]].m_EntryData;
+                    auto&         out   = result[jobs[job]];
+                    const mz_uint flags = tdefl_create_comp_flags_from_zip_params(static_cast<int>(levels[jobs[job]]), -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+                    try {
+                        out.Data.reserve(data.size() / 4);
+                        out.IsValid = tdefl_compress_mem_to_output(
+                            data.data(),
+                            data.size(),
+                            [](const void* buf, int len, void* user) -> mz_bool {
+                                auto* dest  = static_cast<ZipEntryData*>(user);
+                                auto* bytes = static_cast<const unsigned char*>(buf);
+                                dest->insert(dest->end(), bytes, bytes + len);
+                                return MZ_TRUE;
+                            },
+                            &out.Data,
+                            static_cast<int>(flags));
+                        out.Crc32            = static_cast<mz_uint32>(mz_crc32(MZ_CRC32_INIT, data.data(), data.size()));
+                        out.UncompressedSize = data.size();
+                    }
+                    catch (...) {    // e.g. std::bad_alloc: leave the entry to the sequential path
+                        out = Impl::DeflatedData();
+                    }
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (unsigned int t = 1; t < threadCount; ++t) threads.emplace_back(worker);
+            worker();
+            for (auto& thread : threads) thread.join();
+
+            return result;
+        }
+
         mz_zip_archive m_Archive     = mz_zip_archive(); /**< The struct used by miniz, to handle archive files. */
         std::string    m_ArchivePath = "";               /**< The path of the archive file. */
         bool           m_IsOpen      = false;            /**< A flag indicating if the file is currently open for reading and writing. */
 
         std::vector<Impl::ZipEntry> m_ZipEntries = std::vector<Impl::ZipEntry>(); /**< Data structure for all entries in the archive. */
     };
+
+    /**
+     * @brief The ZipEntryWriter class writes the data of an archive entry in chunks, deflating it as it is written, so
+     * that the uncompressed data never has to be held in memory as a whole.
+     * @details The entry is replaced when the writer is closed; until then, the archive is not affected. The deflated data
+     * is kept with the entry and copied into the archive file as is when the archive is saved.
+     */
+    class ZipEntryWriter
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param archive The archive to add the entry to. The archive must outlive the writer.
+         * @param name The name of the entry.
+         * @param level The deflate level (0 to 10).
+         */
+        ZipEntryWriter(ZipArchive& archive, std::string name, unsigned int level)
+            : m_Archive(&archive),
+              m_Name(std::move(name)),
+              m_Compressor(std::make_unique<tdefl_compressor>())
+        {
+            const mz_uint flags = tdefl_create_comp_flags_from_zip_params(static_cast<int>(std::min<unsigned int>(level, MZ_UBER_COMPRESSION)),
+                                                                          -MZ_DEFAULT_WINDOW_BITS,
+                                                                          MZ_DEFAULT_STRATEGY);
+            if (tdefl_init(m_Compressor.get(), &ZipEntryWriter::PutBuffer, &m_Data.Data, static_cast<int>(flags)) != TDEFL_STATUS_OKAY)
+                throw ZipRuntimeError("Failed to initialize the compressor for entry " + m_Name);
+            m_Data.Crc32 = MZ_CRC32_INIT;
+        }
+
+        /**
+         * @brief Copy Constructor (deleted). The compressor writes to m_Data, so the writer can not be copied or moved.
+         */
+        ZipEntryWriter(const ZipEntryWriter& other) = delete;
+
+        /**
+         * @brief Copy Assignment Operator (deleted).
+         */
+        ZipEntryWriter& operator=(const ZipEntryWriter& other) = delete;
+
+        /**
+         * @brief Deflate a chunk of the entry data.
+         * @param data The data.
+         * @param size The size of the data in bytes.
+         */
+        void Write(const void* data, size_t size)
+        {
+            if (!m_Compressor) throw ZipLogicError("Cannot call Write on a closed ZipEntryWriter!");
+            if (size == 0) return;
+            m_Data.Crc32 = static_cast<mz_uint32>(mz_crc32(m_Data.Crc32, static_cast<const mz_uint8*>(data), size));
+            m_Data.UncompressedSize += size;
+            if (tdefl_compress_buffer(m_Compressor.get(), data, size, TDEFL_NO_FLUSH) != TDEFL_STATUS_OKAY)
+                throw ZipRuntimeError("Failed to deflate data of entry " + m_Name);
+        }
+
+        /**
+         * @brief Finish the deflate stream and replace the entry in the archive.
+         */
+        void Close()
+        {
+            if (!m_Compressor) return;
+            if (tdefl_compress_buffer(m_Compressor.get(), nullptr, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE)
+                throw ZipRuntimeError("Failed to deflate data of entry " + m_Name);
+            m_Compressor.reset();
+            m_Data.IsValid = true;
+            m_Archive->AddDeflatedEntry(m_Name, std::move(m_Data));
+        }
+
+    private:
+        /**
+         * @brief The output callback of the compressor, appending to the deflated data.
+         */
+        static mz_bool PutBuffer(const void* buffer, int length, void* user)
+        {
+            auto* dest  = static_cast<ZipEntryData*>(user);
+            auto* bytes = static_cast<const unsigned char*>(buffer);
+            dest->insert(dest->end(), bytes, bytes + length);
+            return MZ_TRUE;
+        }
+
+        ZipArchive*                       m_Archive;    /**< The archive the entry is added to. */
+        std::string                       m_Name;       /**< The name of the entry. */
+        std::unique_ptr<tdefl_compressor> m_Compressor; /**< The compressor; reset once the writer is closed. */
+        Impl::DeflatedData                m_Data {};    /**< The deflated data written so far. */
+    };
 }    // namespace Zippy
 
 #ifdef _MSC_VER // avoid other compilers complaining about MSVC-only pragmas being unknown
@@ -55,11 +55,71 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace OpenXLSX
 {
+    /**
+     * @brief A forward-only stream over the data of an archive entry. Each call copies up to size bytes into buffer and
+     * returns the number of bytes copied, or 0 at the end of the data.
+     */
+    using XLZipEntryStream = std::function<size_t(char* buffer, size_t size)>;
+
+    /**
+     * @brief The deflate level used for modified entries when a zip archive is saved. Store writes entries uncompressed.
+     */
+    enum class XLCompressionLevel : uint8_t { Store = 0, Fast = 1, Default = 6, Max = 9 };
+
+    /**
+     * @brief Options that control how a zip archive is written when it is saved.
+     */
+    struct XLZipSaveOptions
+    {
+        unsigned int       compressionThreads {1};                         /**< Threads deflating modified entries in parallel; 0 = one per hardware thread */
+        XLCompressionLevel compressionLevel {XLCompressionLevel::Default}; /**< Level for modified entries not matched by entryCompressionLevels */
+
+        /**
+         * @brief Per entry overrides of compressionLevel, as pairs of an entry name pattern and a level. Patterns may use the
+         * wildcards '*' (any sequence of characters, including '/') and '?' (any single character); the first match wins.
+         * For example, the pattern "xl/media/" followed by '*', with XLCompressionLevel::Store, stores images uncompressed.
+         */
+        std::vector<std::pair<std::string, XLCompressionLevel>> entryCompressionLevels {};
+
+        /**
+         * @brief If true, the saved archive is validated by reading back and inflating every entry, and then reopened. By
+         * default, only the central directory (with the CRC-32 and sizes computed while writing) is read back and checked.
+         */
+        bool fullValidation {false};
+    };
+
+    /**
+     * @brief Receives the data of an archive entry in chunks and deflates it as it is written, so that the uncompressed data
+     * is never held in memory as a whole. The entry is replaced when the writer is closed; a writer destroyed without being
+     * closed leaves the entry unchanged.
+     */
+    class OPENXLSX_EXPORT XLZipEntryWriter
+    {
+    public:
+        virtual ~XLZipEntryWriter() = default;
+
+        /**
+         * @brief Append data to the entry.
+         * @param data The data
+         * @param size The size of the data in bytes
+         */
+        virtual void write(const char* data, size_t size) = 0;
+
+        /**
+         * @brief Finish the entry and replace it in the archive. Further calls have no effect.
+         */
+        virtual void close() = 0;
+    };
+
     /**
      * @brief This class functions as a wrapper around any class that provides the necessary functionality for
      * a zip archive.
@@ -159,8 +219,8 @@ namespace OpenXLSX
             m_zipArchive->close();
         }
 
-        inline void save(const std::string& path) {
-            m_zipArchive->save(path);
+        inline void save(const std::string& path, const XLZipSaveOptions& options = {}) {
+            m_zipArchive->save(path, options);
         }
 
         inline void addEntry(const std::string& name, const std::string& data) {
@@ -179,6 +239,14 @@ namespace OpenXLSX
             return m_zipArchive->hasEntry(entryName);
         }
 
+        inline XLZipEntryStream getEntryStream(const std::string& name) const {
+            return m_zipArchive->getEntryStream(name);
+        }
+
+        inline std::unique_ptr<XLZipEntryWriter> openEntryWriter(const std::string& name, const XLZipSaveOptions& options) {
+            return m_zipArchive->openEntryWriter(name, options);
+        }
+
     private:
         /**
          * @brief
@@ -232,7 +300,7 @@ namespace OpenXLSX
 
             inline virtual void close() = 0;
 
-            inline virtual void save (const std::string& path) = 0;
+            inline virtual void save (const std::string& path, const XLZipSaveOptions& options) = 0;
 
             inline virtual void addEntry(const std::string& name, const std::string& data) = 0;
 
@@ -242,6 +310,10 @@ namespace OpenXLSX
 
             inline virtual bool hasEntry(const std::string& entryName) const = 0;
 
+            inline virtual XLZipEntryStream getEntryStream(const std::string& name) const = 0;
+
+            inline virtual std::unique_ptr<XLZipEntryWriter> openEntryWriter(const std::string& name, const XLZipSaveOptions& options) = 0;
+
         };
 
         /**
@@ -314,8 +386,8 @@ namespace OpenXLSX
                 ZipType.close();
             }
 
-            inline void save(const std::string& path) override {
-                ZipType.save(path);
+            inline void save(const std::string& path, const XLZipSaveOptions& options) override {
+                ZipType.save(path, options);
             }
 
             inline void addEntry(const std::string& name, const std::string& data) override {
@@ -334,6 +406,14 @@ namespace OpenXLSX
                 return ZipType.hasEntry(entryName);
             }
 
+            inline XLZipEntryStream getEntryStream(const std::string& name) const override {
+                return ZipType.getEntryStream(name);
+            }
+
+            inline std::unique_ptr<XLZipEntryWriter> openEntryWriter(const std::string& name, const XLZipSaveOptions& options) override {
+                return ZipType.openEntryWriter(name, options);
+            }
+
         private:
             T ZipType;
         };
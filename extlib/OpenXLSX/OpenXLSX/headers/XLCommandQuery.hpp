@@ -142,7 +142,8 @@ namespace OpenXLSX
         QuerySheetRelsID,
         QuerySheetRelsTarget,
         QuerySharedStrings,
-        QueryXmlData
+        QueryXmlData,
+        QueryXmlStream
     };
 
     /**
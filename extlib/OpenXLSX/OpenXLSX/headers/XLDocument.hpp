@@ -207,20 +207,53 @@ namespace OpenXLSX
 
         /**
          * @brief Save the current document using the current filename, overwriting the existing file.
+         * @note The archive is written with the options set by setSaveOptions
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
          */
         void save();
 
+        /**
+         * @brief Save the current document using the current filename, overwriting the existing file.
+         * @param options Archive options for this save, e.g. compression level and threads, instead of saveOptions()
+         * @throw XLException (OpenXLSX failed checks)
+         * @throw ZipRuntimeError (zippy failed archive / file access)
+         */
+        void save(const XLZipSaveOptions& options);
+
         /**
          * @brief Save the document with a new name. If a file exists with that name, it will be overwritten.
          * @param fileName The path of the file
          * @param forceOverwrite If not true (XLForceOverwrite) and fileName exists, saveAs will throw an exception
+         * @note The archive is written with the options set by setSaveOptions
          * @throw XLException (OpenXLSX failed checks)
          * @throw ZipRuntimeError (zippy failed archive / file access)
          */
         void saveAs(const std::string& fileName, bool forceOverwrite);
 
+        /**
+         * @brief Save the document with a new name. If a file exists with that name, it will be overwritten.
+         * @param fileName The path of the file
+         * @param forceOverwrite If not true (XLForceOverwrite) and fileName exists, saveAs will throw an exception
+         * @param options Archive options for this save, e.g. compression level and threads, instead of saveOptions()
+         * @throw XLException (OpenXLSX failed checks)
+         * @throw ZipRuntimeError (zippy failed archive / file access)
+         */
+        void saveAs(const std::string& fileName, bool forceOverwrite, const XLZipSaveOptions& options);
+
+        /**
+         * @brief Set the archive options used by save() and saveAs() when no options are passed. The options are kept
+         * when another document is opened or created with this object.
+         * @param options The archive options, e.g. the compression level of modified parts
+         */
+        void setSaveOptions(const XLZipSaveOptions& options);
+
+        /**
+         * @brief Get the archive options used by save() and saveAs() when no options are passed
+         * @return The archive options
+         */
+        const XLZipSaveOptions& saveOptions() const;
+
         /**
          * @brief Save the document with a new name. Legacy interface, invokes saveAs( fileName, XLForceOverwrite )
          * @param fileName The path of the file
@@ -404,6 +437,14 @@ namespace OpenXLSX
          */
         std::string extractXmlFromArchive(const std::string& path);
 
+        /**
+         * @brief Open an XML file in the .xlsx archive for writing its content incrementally.
+         * @param path The relative path of the file.
+         * @return A writer deflating the data as it is written, with the compression level of the save options. The file is
+         * replaced when the writer is closed; the caller must unload the corresponding XLXmlData then.
+         */
+        std::unique_ptr<XLZipEntryWriter> openXmlWriter(const std::string& path);
+
         /**
          * @brief fetch the XLXmlData object as stored in m_data, throw XLInternalError if path is not found
          * @param path The relative path of the file.
@@ -438,8 +479,11 @@ namespace OpenXLSX
 
         XLXmlSavingDeclaration m_xmlSavingDeclaration;  /**< The xml saving declaration that will be passed to pugixml before generating the XML output data*/
 
+        XLZipSaveOptions m_saveOptions {};  /**< The archive options used by save() and saveAs() when none are passed*/
+
         mutable std::list<XLXmlData>    m_data {};              /**<  */
         mutable std::deque<std::string> m_sharedStringCache {}; /**<  */
+        mutable XLSharedStringIndex     m_sharedStringIndex {}; /**< views into m_sharedStringCache, must be declared after it */
         mutable XLSharedStrings         m_sharedStrings {};     /**<  */
 
         XLRelationships m_docRelationships {}; /**< A pointer to the document relationships object*/
@@ -0,0 +1,129 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLROWINDEX_HPP
+#define OPENXLSX_XLROWINDEX_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint32_t
+#include <map>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+#include "XLXmlParser.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLRowIndex class maps row numbers to the <row> nodes of a worksheet's <sheetData>, so that rows can be
+     * located in logarithmic time instead of by walking the sibling list. The index is owned by the worksheet's
+     * XLXmlData and built lazily on first use.
+     * @note Rows that were inserted without going through the index (e.g. by row or cell iterators) are picked up
+     * on the next lookup in their vicinity. Rows must not be removed behind the index's back - use erase.
+     */
+    class OPENXLSX_EXPORT XLRowIndex
+    {
+    public:
+        /**
+         * @brief Retrieve the row node for rowNumber, creating it at the correct position if it does not exist.
+         * @param sheetDataNode the worksheet's <sheetData> node
+         * @param rowNumber the row to look up, in the range [1;MAX_ROWS]
+         * @return the XML node of the requested row
+         * @throw XLCellAddressError if rowNumber is out of range
+         */
+        XMLNode getRowNode(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Retrieve the row node for rowNumber without creating it.
+         * @param sheetDataNode the worksheet's <sheetData> node
+         * @param rowNumber the row to look up
+         * @return the XML node of the requested row, or an empty node if the row does not exist
+         */
+        XMLNode findRowNode(XMLNode sheetDataNode, uint32_t rowNumber);
+
+        /**
+         * @brief Remove rowNumber from the index. Must be called before the row node is removed from the document.
+         * @param rowNumber the row that is about to be deleted
+         */
+        void erase(uint32_t rowNumber);
+
+        /**
+         * @brief Drop the index, e.g. because the underlying XML document was reloaded. It is rebuilt on next use.
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief Locate (and optionally create) a row node, using the index as a starting point
+         * @param sheetDataNode the worksheet's <sheetData> node
+         * @param rowNumber the row to look up
+         * @param createIfMissing if true, a missing row is inserted into the XML and the index
+         * @return the XML node of the requested row, or an empty node if the row does not exist and createIfMissing is false
+         */
+        XMLNode locate(XMLNode sheetDataNode, uint32_t rowNumber, bool createIfMissing);
+
+        /**
+         * @brief (Re-)build the index from all row nodes currently in sheetDataNode
+         * @param sheetDataNode the worksheet's <sheetData> node
+         */
+        void build(XMLNode sheetDataNode);
+
+        std::map<uint32_t, XMLNode> m_rows {};            /**< row number -> <row> node, in ascending order */
+        XMLNode                     m_sheetDataNode {};   /**< the <sheetData> node the index was built for */
+        bool                        m_built { false };    /**< true once build has been called since the last clear */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLROWINDEX_HPP
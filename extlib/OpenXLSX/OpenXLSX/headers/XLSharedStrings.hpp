@@ -57,6 +57,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <limits>     // std::numeric_limits
 #include <ostream>    // std::basic_ostream
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
@@ -69,6 +71,12 @@ namespace OpenXLSX
     class XLSharedStrings; // forward declaration
     typedef std::reference_wrapper< const XLSharedStrings > XLSharedStringsRef;
 
+    /**
+     * @brief Reverse lookup from shared string content to the lowest index holding that content. The keys view into the
+     * std::string objects of the shared strings cache, which never change their memory address (std::deque).
+     */
+    typedef std::unordered_map< std::string_view, int32_t > XLSharedStringIndex;
+
     extern const XLSharedStrings XLSharedStringsDefaulted; // to be used for default initialization of all references of type XLSharedStrings
 
     /**
@@ -95,8 +103,9 @@ namespace OpenXLSX
          * @brief
          * @param xmlData
          * @param stringCache
+         * @param stringIndex hash index into stringCache, must be kept consistent with stringCache by the owner
          */
-        explicit XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache);
+        explicit XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache, XLSharedStringIndex* stringIndex);
 
         /**
          * @brief Destructor
@@ -187,13 +196,21 @@ namespace OpenXLSX
 
     protected:
         /**
-         * @brief clear & rewrite the full shared strings XML from the shared strings cache
+         * @brief clear & rewrite the full shared strings XML from the shared strings cache, and rebuild the string index
          * @return the amount of strings written to XML (should be equal to m_stringCache->size())
          */
         int32_t rewriteXmlFromCache();
 
     private:
+        /**
+         * @brief add str at index to m_stringIndex, unless the same string is already indexed at a lower index
+         * @param str a string stored in m_stringCache
+         * @param index the index of str in m_stringCache
+         */
+        void indexString(const std::string& str, int32_t index) const;
+
         std::deque<std::string>* m_stringCache {}; /** < Each string must have an unchanging memory address; hence the use of std::deque */
+        XLSharedStringIndex*     m_stringIndex {}; /** < O(1) lookup of string content -> index in m_stringCache */
     };
 }    // namespace OpenXLSX
 
@@ -1014,6 +1014,18 @@ namespace OpenXLSX
          */
         XLRow row(uint32_t rowNumber) const;
 
+        /**
+         * @brief Assign values to consecutive cells of a row.
+         * @details The row node is located once and its cell nodes are visited in a single forward pass, creating
+         * missing cells in place. Writing a block row by row thus avoids searching the row for every cell and
+         * formatting and parsing cell addresses.
+         * @param rowNumber The number of the row to write to.
+         * @param firstColumn The column of the first value.
+         * @param values The values to assign. An empty value clears the value of its cell.
+         * @throw XLCellAddressError if rowNumber or any of the columns is out of range.
+         */
+        void setRowValues(uint32_t rowNumber, uint16_t firstColumn, const std::vector<XLCellValue>& values) const;
+
         /**
          * @brief Get the column with the given column number.
          * @param columnNumber The number of the column to retrieve.
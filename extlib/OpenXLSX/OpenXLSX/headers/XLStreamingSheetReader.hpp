@@ -0,0 +1,183 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSTREAMINGSHEETREADER_HPP
+#define OPENXLSX_XLSTREAMINGSHEETREADER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint16_t, uint32_t
+#include <string>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
+#include "OpenXLSX-Exports.hpp"
+#include "XLCellValue.hpp"
+#include "XLConstants.hpp"
+#include "XLSharedStrings.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief The XLStreamingSheetReader class reads the cell values of a worksheet row by row, directly from the
+     * (compressed) worksheet XML. No DOM is built, and memory use does not depend on the size of the worksheet, which
+     * makes it suitable for reading worksheets that are too large to load with XLWorksheet.
+     * @details Readers are obtained from XLWorkbook::worksheetReader. Only cell values are reported: formulas are
+     * skipped (the cached value is reported instead), and styles are ignored. Rows that are not present in the
+     * worksheet XML are skipped.
+     * @warning A reader must not be used after its document has been closed or saved.
+     */
+    class OPENXLSX_EXPORT XLStreamingSheetReader
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param stream The stream delivering the worksheet XML.
+         * @param sharedStrings The shared strings of the document, used to resolve shared string cells.
+         */
+        XLStreamingSheetReader(XLZipEntryStream stream, const XLSharedStrings& sharedStrings);
+
+        /**
+         * @brief Copy constructor (deleted).
+         */
+        XLStreamingSheetReader(const XLStreamingSheetReader& other) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        XLStreamingSheetReader(XLStreamingSheetReader&& other) = default;
+
+        /**
+         * @brief Destructor
+         */
+        ~XLStreamingSheetReader();
+
+        /**
+         * @brief Copy assignment operator (deleted).
+         */
+        XLStreamingSheetReader& operator=(const XLStreamingSheetReader& other) = delete;
+
+        /**
+         * @brief Move assignment operator.
+         */
+        XLStreamingSheetReader& operator=(XLStreamingSheetReader&& other) = default;
+
+        /**
+         * @brief Read the next row of the worksheet.
+         * @param values Receives the values of the row, where values[0] is the value in column A. The vector ends at
+         * the last cell present in the row (or at lastColumn), and columns without a cell hold an empty value.
+         * @param lastColumn Cells to the right of this column are skipped without being decoded.
+         * @return The number of the row that was read, or 0 if there are no more rows.
+         * @throw XLInternalError if the worksheet XML ends prematurely.
+         */
+        uint32_t nextRow(std::vector<XLCellValue>& values, uint16_t lastColumn = MAX_COLS);
+
+    private:
+        /**
+         * @brief The kinds of XML tokens reported by nextToken.
+         */
+        enum class TokenType : uint8_t { Text, StartTag, EndTag, EndOfData };
+
+        /**
+         * @brief Append the next chunk of the stream to the buffer, discarding the data already consumed.
+         * @return false if the stream is exhausted.
+         */
+        bool fill();
+
+        /**
+         * @brief Find a string in the unconsumed data, reading more data as required.
+         * @param str The string to look for.
+         * @param offset The offset from the current position at which to start looking.
+         * @return The offset of str from the current position, or std::string::npos if the stream ends first.
+         */
+        size_t find(const char* str, size_t offset = 0);
+
+        /**
+         * @brief Read the next token. The tag name (without namespace prefix) is stored in m_name, the attributes of a
+         * start tag in m_attributes and the decoded text of a text token in m_text.
+         * @return The type of the token.
+         */
+        TokenType nextToken();
+
+        /**
+         * @brief Get the value of an attribute of the last start tag.
+         * @param name The name of the attribute.
+         * @return The (undecoded) attribute value, or an empty string if the attribute is not present.
+         */
+        std::string attribute(const char* name) const;
+
+        /**
+         * @brief Read the contents of a <c> element up to and including its end tag.
+         * @param type The value of the t attribute of the cell.
+         * @return The value of the cell.
+         */
+        XLCellValue readCell(const std::string& type);
+
+        XLZipEntryStream   m_stream;                  /**< The stream delivering the worksheet XML */
+        XLSharedStringsRef m_sharedStrings;           /**< The shared strings of the document */
+        std::string        m_buffer {};               /**< The data read from the stream but not yet discarded */
+        size_t             m_pos {};                  /**< The position of the first unconsumed character in m_buffer */
+        bool               m_endOfStream {false};     /**< Set once the stream is exhausted */
+        bool               m_inSheetData {false};     /**< Set once the <sheetData> start tag has been read */
+        bool               m_endOfSheetData {false};  /**< Set once all rows have been read */
+        bool               m_selfClosing {false};     /**< Set if the last start tag was self-closing */
+        std::string        m_name {};                 /**< The name of the last tag */
+        std::string        m_attributes {};           /**< The attributes of the last start tag */
+        std::string        m_text {};                 /**< The decoded contents of the last text token */
+        uint32_t           m_rowNumber {};            /**< The number of the last row read */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMINGSHEETREADER_HPP
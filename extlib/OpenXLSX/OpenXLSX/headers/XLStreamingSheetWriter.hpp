@@ -0,0 +1,188 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLSTREAMINGSHEETWRITER_HPP
+#define OPENXLSX_XLSTREAMINGSHEETWRITER_HPP
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#   pragma warning(disable : 4275)
+#endif // _MSC_VER
+
+// ===== External Includes ===== //
+#include <cstdint>    // uint8_t, uint16_t, uint32_t
+#include <memory>     // std::unique_ptr
+#include <string>
+#include <vector>
+
+// ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
+#include "OpenXLSX-Exports.hpp"
+#include "XLCellValue.hpp"
+#include "XLSharedStrings.hpp"
+
+namespace OpenXLSX
+{
+    class XLXmlData;
+
+    /**
+     * @brief How an XLStreamingSheetWriter stores string values.
+     */
+    enum class XLStringStorage : uint8_t {
+        SharedStrings,    /**< Strings are added to (or looked up in) the shared strings table, as done by XLCell */
+        InlineStrings     /**< Strings are written into the cells, so the shared strings table does not grow */
+    };
+
+    /**
+     * @brief The XLStreamingSheetWriter class writes the rows of a worksheet in ascending order, serializing the cells
+     * directly into the deflated worksheet entry of the archive. No DOM is built and the uncompressed worksheet XML is
+     * never held in memory as a whole, which makes it suitable for generating worksheets with millions of rows.
+     * @details Writers are obtained from XLWorkbook::worksheetWriter. Writing replaces the rows of the worksheet; all other
+     * worksheet content (columns, views, merged cells etc.) is kept. Only values are written: cells get the default style.
+     * The worksheet is replaced when the writer is closed, and is written to disk by the next XLDocument::save. A writer
+     * that is aborted, or destroyed without being closed, leaves the worksheet unchanged.
+     * @warning XLWorksheet objects of the worksheet must not be used while the writer is open, and are invalidated when
+     * it is closed. Obtain the worksheet again from the workbook afterwards.
+     */
+    class OPENXLSX_EXPORT XLStreamingSheetWriter
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param xmlData The XLXmlData of the worksheet, used to keep the worksheet content outside the rows.
+         * @param writer The writer for the worksheet entry in the archive.
+         * @param sharedStrings The shared strings of the document.
+         * @param stringStorage How string values are stored.
+         */
+        XLStreamingSheetWriter(XLXmlData*                        xmlData,
+                               std::unique_ptr<XLZipEntryWriter> writer,
+                               const XLSharedStrings&            sharedStrings,
+                               XLStringStorage                   stringStorage);
+
+        /**
+         * @brief Copy constructor (deleted).
+         */
+        XLStreamingSheetWriter(const XLStreamingSheetWriter& other) = delete;
+
+        /**
+         * @brief Move constructor.
+         */
+        XLStreamingSheetWriter(XLStreamingSheetWriter&& other) = default;
+
+        /**
+         * @brief Destructor. Aborts the writer if close was not called, so an incomplete worksheet is never committed.
+         */
+        ~XLStreamingSheetWriter();
+
+        /**
+         * @brief Copy assignment operator (deleted).
+         */
+        XLStreamingSheetWriter& operator=(const XLStreamingSheetWriter& other) = delete;
+
+        /**
+         * @brief Move assignment operator (deleted), as the assigned-to writer would have to be closed.
+         */
+        XLStreamingSheetWriter& operator=(XLStreamingSheetWriter&& other) = delete;
+
+        /**
+         * @brief Write a row.
+         * @param rowNumber The row number; must be greater than the number of the previous row written.
+         * @param values The values of the row. Empty values are skipped, so no cell is written for them.
+         * @param firstColumn The column of values[0].
+         * @throw XLInputError if the writer is closed, or if the row number or columns are out of range.
+         */
+        void writeRow(uint32_t rowNumber, const std::vector<XLCellValue>& values, uint16_t firstColumn = 1);
+
+        /**
+         * @brief Write a row directly below the previous row written (or row 1).
+         * @param values The values of the row, starting in column A.
+         */
+        void appendRow(const std::vector<XLCellValue>& values);
+
+        /**
+         * @brief Get the number of the last row written.
+         * @return The row number, or 0 if no row has been written yet.
+         */
+        uint32_t rowNumber() const { return m_rowNumber; }
+
+        /**
+         * @brief Finish the worksheet and replace it in the archive. Further calls have no effect.
+         */
+        void close();
+
+        /**
+         * @brief Discard the rows written so far, leaving the worksheet as it was. Further calls, and calls to close, have
+         * no effect.
+         * @note Strings already added to the shared strings table stay there; they are harmless if unused.
+         */
+        void abort() noexcept;
+
+    private:
+        /**
+         * @brief Append a value to m_buffer, escaping the characters that are not allowed in XML text.
+         */
+        void appendEscaped(const std::string& text);
+
+        /**
+         * @brief Hand the contents of m_buffer to the archive writer.
+         */
+        void flush();
+
+        XLXmlData*                        m_xmlData;           /**< The worksheet XML data, unloaded on close */
+        std::unique_ptr<XLZipEntryWriter> m_writer;            /**< The writer of the worksheet entry; null once closed */
+        XLSharedStringsRef                m_sharedStrings;     /**< The shared strings of the document */
+        XLStringStorage                   m_stringStorage;     /**< How string values are stored */
+        std::string                       m_buffer {};         /**< Serialized XML not yet handed to m_writer */
+        std::string                       m_closingXml {};     /**< The worksheet XML following the rows */
+        uint32_t                          m_rowNumber {};      /**< The number of the last row written */
+    };
+}    // namespace OpenXLSX
+
+#ifdef _MSC_VER    // conditionally enable MSVC specific pragmas to avoid other compilers warning about unknown pragmas
+#   pragma warning(pop)
+#endif // _MSC_VER
+
+#endif    // OPENXLSX_XLSTREAMINGSHEETWRITER_HPP
@@ -54,8 +54,10 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== External Includes ===== //
 #include <cstdint>   // uint32_t etc
+#include <functional>   // std::function
 #include <string>
 #include <string_view>  // std::string_view
+#include <unordered_map>
 #include <vector>
 
 // ===== OpenXLSX Includes ===== //
@@ -227,6 +229,17 @@ namespace OpenXLSX
         XLReadingOrderRightToLeft = 2
     };
 
+    /**
+     * @brief Maps a canonical text form of style entries (fonts, fills, borders, cell formats) to their index, so that
+     * findOrCreate can return an existing identical entry instead of appending a duplicate. The table is filled lazily,
+     * and an entry is re-checked against the XML before it is reused, since entries can be modified in place.
+     */
+    struct XLStyleInternTable
+    {
+        std::unordered_map<std::string, XLStyleIndex> indexByForm {};    /**< canonical form -> lowest known index */
+        size_t                                         indexedCount {};  /**< entries [0;indexedCount) are in indexByForm */
+    };
+
     // ================================================================================
     // XLNumberFormats Class
     // ================================================================================
@@ -668,9 +681,21 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLFont copyFrom = XLFont{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Append a copy of copyFrom, adjusted by modify, unless an identical font entry already exists
+         * @param copyFrom The XLFont to use as template for the new style. It is never modified itself.
+         * @param modify Applied to the new copy before it is compared to the existing entries
+         * @param styleEntriesPrefix Prefix the newly created cell style XMLNode with this pugi::node_pcdata text
+         * @returns The index of the identical existing style, or of the newly created style
+         */
+        XLStyleIndex findOrCreate(XLFont copyFrom,
+                                  std::function<void(XLFont&)> const& modify = {},
+                                  std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_fontsNode;        /**< An XMLNode object with the fonts item */
         std::vector<XLFont> m_fonts;
+        XLStyleInternTable m_internTable;            /**< Canonical form -> index of the entries, used by findOrCreate */
     };
 
 
@@ -1141,9 +1166,21 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLFill copyFrom = XLFill{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Append a copy of copyFrom, adjusted by modify, unless an identical fill entry already exists
+         * @param copyFrom The XLFill to use as template for the new style. It is never modified itself.
+         * @param modify Applied to the new copy before it is compared to the existing entries
+         * @param styleEntriesPrefix Prefix the newly created cell style XMLNode with this pugi::node_pcdata text
+         * @returns The index of the identical existing style, or of the newly created style
+         */
+        XLStyleIndex findOrCreate(XLFill copyFrom,
+                                  std::function<void(XLFill&)> const& modify = {},
+                                  std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_fillsNode;        /**< An XMLNode object with the fills item */
         std::vector<XLFill> m_fills;
+        XLStyleInternTable m_internTable;            /**< Canonical form -> index of the entries, used by findOrCreate */
     };
 
 
@@ -1446,9 +1483,21 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLBorder copyFrom = XLBorder{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Append a copy of copyFrom, adjusted by modify, unless an identical border entry already exists
+         * @param copyFrom The XLBorder to use as template for the new style. It is never modified itself.
+         * @param modify Applied to the new copy before it is compared to the existing entries
+         * @param styleEntriesPrefix Prefix the newly created cell style XMLNode with this pugi::node_pcdata text
+         * @returns The index of the identical existing style, or of the newly created style
+         */
+        XLStyleIndex findOrCreate(XLBorder copyFrom,
+                                  std::function<void(XLBorder&)> const& modify = {},
+                                  std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_bordersNode;      /**< An XMLNode object with the borders item */
         std::vector<XLBorder> m_borders;
+        XLStyleInternTable m_internTable;            /**< Canonical form -> index of the entries, used by findOrCreate */
     };
 
 
@@ -1870,9 +1919,21 @@ namespace OpenXLSX
          */
         XLStyleIndex create(XLCellFormat copyFrom = XLCellFormat{}, std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
 
+        /**
+         * @brief Append a copy of copyFrom, adjusted by modify, unless an identical xf entry already exists
+         * @param copyFrom The XLCellFormat to use as template for the new style. It is never modified itself.
+         * @param modify Applied to the new copy before it is compared to the existing entries
+         * @param styleEntriesPrefix Prefix the newly created cell style XMLNode with this pugi::node_pcdata text
+         * @returns The index of the identical existing style, or of the newly created style
+         */
+        XLStyleIndex findOrCreate(XLCellFormat copyFrom,
+                                  std::function<void(XLCellFormat&)> const& modify = {},
+                                  std::string styleEntriesPrefix = XLDefaultStyleEntriesPrefix);
+
     private:                                         // ---------- Private Member Variables ---------- //
         std::unique_ptr<XMLNode> m_cellFormatsNode;  /**< An XMLNode object with the cell formats item */
         std::vector<XLCellFormat> m_cellFormats;
+        XLStyleInternTable m_internTable;            /**< Canonical form -> index of the entries, used by findOrCreate */
         bool m_permitXfId{false};
     };
 
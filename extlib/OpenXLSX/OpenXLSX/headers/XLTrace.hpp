@@ -0,0 +1,124 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+#ifndef OPENXLSX_XLTRACE_HPP
+#define OPENXLSX_XLTRACE_HPP
+
+// ===== External Includes ===== //
+#include <chrono>
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "OpenXLSX-Exports.hpp"
+
+namespace OpenXLSX
+{
+    /**
+     * @brief Receives a completed trace span.
+     * @param name the name of the span, a string literal
+     * @param detail what the span worked on, e.g. an archive entry name; may be empty
+     * @param start the time the span started
+     * @param end the time the span ended
+     * @note Called on the thread that ran the span.
+     */
+    using XLTraceSink = void (*)(const char*                           name,
+                                 const std::string&                    detail,
+                                 std::chrono::steady_clock::time_point start,
+                                 std::chrono::steady_clock::time_point end);
+
+    /**
+     * @brief Set the function that receives the trace spans of document I/O (opening, parsing, inflating and saving),
+     * or nullptr to drop them.
+     * @note Spans are only reported if the library was built with OPENXLSX_ENABLE_TRACING. Otherwise the span macros
+     * compile to nothing and the sink is never called.
+     */
+    OPENXLSX_EXPORT void setTraceSink(XLTraceSink sink);
+
+    /**
+     * @brief Get the function set by setTraceSink.
+     * @return the sink, or nullptr
+     */
+    OPENXLSX_EXPORT XLTraceSink traceSink();
+
+    /**
+     * @brief Reports the time from its construction to its destruction to the trace sink, if one was set when it
+     * was constructed. Used through OPENXLSX_TRACE_SCOPE.
+     */
+    class XLTraceScope
+    {
+    public:
+        XLTraceScope(const char* name, const std::string& detail) : m_sink(traceSink()), m_name(name)
+        {
+            if (m_sink) {
+                m_detail = detail;
+                m_start  = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~XLTraceScope()
+        {
+            if (m_sink) m_sink(m_name, m_detail, m_start, std::chrono::steady_clock::now());
+        }
+
+        XLTraceScope(const XLTraceScope&)            = delete;
+        XLTraceScope& operator=(const XLTraceScope&) = delete;
+
+    private:
+        XLTraceSink                           m_sink;     /**< the sink at construction, nullptr if tracing is off */
+        const char*                           m_name;     /**< the name of the span */
+        std::string                           m_detail;   /**< what the span worked on */
+        std::chrono::steady_clock::time_point m_start;    /**< the time the span started */
+    };
+}    // namespace OpenXLSX
+
+#ifdef OPENXLSX_ENABLE_TRACING
+#   define OPENXLSX_TRACE_CONCAT_(a, b) a##b
+#   define OPENXLSX_TRACE_CONCAT(a, b) OPENXLSX_TRACE_CONCAT_(a, b)
+#   define OPENXLSX_TRACE_SCOPE(name, detail) OpenXLSX::XLTraceScope OPENXLSX_TRACE_CONCAT(xlTraceScope, __LINE__)(name, detail)
+#else
+#   define OPENXLSX_TRACE_SCOPE(name, detail) ((void)0)
+#endif
+
+#endif    // OPENXLSX_XLTRACE_HPP
@@ -58,6 +58,8 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
+#include "XLStreamingSheetReader.hpp"
+#include "XLStreamingSheetWriter.hpp"
 #include "XLXmlFile.hpp"
 
 namespace OpenXLSX
@@ -149,6 +151,25 @@ namespace OpenXLSX
          */
         XLSheet sheet(const std::string& sheetName);
 
+        /**
+         * @brief Get a forward-only reader over the cell values of the worksheet with the given name, without loading
+         * the worksheet into memory.
+         * @param sheetName The name of the desired worksheet.
+         * @return A reader positioned before the first row of the worksheet.
+         * @throw XLInputError if no worksheet with that name exists.
+         */
+        XLStreamingSheetReader worksheetReader(const std::string& sheetName);
+
+        /**
+         * @brief Get a writer that replaces the rows of the worksheet with the given name, without loading the rows into
+         * memory.
+         * @param sheetName The name of the desired worksheet.
+         * @param stringStorage Whether strings are stored in the shared strings table or inline in the cells.
+         * @return A writer positioned before row 1. The worksheet is replaced when the writer is closed.
+         * @throw XLInputError if no worksheet with that name exists.
+         */
+        XLStreamingSheetWriter worksheetWriter(const std::string& sheetName, XLStringStorage stringStorage = XLStringStorage::SharedStrings);
+
         /**
          * @brief Get the worksheet with the given name.
          * @param sheetName The name of the desired worksheet.
@@ -332,6 +353,13 @@ namespace OpenXLSX
          */
         std::string sheetID(const std::string& sheetName);
 
+        /**
+         * @brief Get the path of a sheet's XML part in the archive.
+         * @param sheetName The name of an existing sheet.
+         * @return The path, e.g. "xl/worksheets/sheet1.xml".
+         */
+        std::string sheetXmlPath(const std::string& sheetName);
+
         /**
          * @brief
          * @param sheetID
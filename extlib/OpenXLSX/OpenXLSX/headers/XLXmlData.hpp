@@ -53,12 +53,14 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 // ===== External Includes ===== //
+#include <cstdint>    // uint64_t
 #include <memory>
 #include <string>
 
 // ===== OpenXLSX Includes ===== //
 #include "OpenXLSX-Exports.hpp"
 #include "XLContentTypes.hpp"
+#include "XLRowIndex.hpp"
 #include "XLXmlParser.hpp"
 
 namespace OpenXLSX
@@ -232,7 +234,39 @@ namespace OpenXLSX
          */
         bool empty() const;
 
+        /**
+         * @brief Access the row index of a worksheet's <sheetData>. The index is created on first access and dropped
+         * whenever the XML document is (re-)loaded.
+         * @return A reference to the XLRowIndex object.
+         */
+        XLRowIndex& rowIndex();
+
+        /**
+         * @brief Check whether the XML document differs from the state it was loaded from (or last saved as).
+         * @details Parts that were never parsed are unmodified. For parsed parts, a fingerprint of the DOM is compared
+         * against the one taken when the part was loaded, since nodes can be modified through any XMLNode handle.
+         * @return true if the part needs to be written to the archive on the next save
+         */
+        bool isModified() const;
+
+        /**
+         * @brief Record the current state of the XML document as the saved state, see isModified
+         */
+        void setSaved();
+
+        /**
+         * @brief Discard the parsed XML document, so that it is loaded from the archive again on next access.
+         * @note Used after the part was replaced in the archive directly. XMLNodes of the discarded document become invalid.
+         */
+        void unload();
+
     private:
+        /**
+         * @brief Compute a hash over all nodes and attributes of the XML document
+         * @return the fingerprint of the current document state
+         */
+        uint64_t fingerprint() const;
+
         // ===== PRIVATE MEMBER VARIABLES ===== //
 
         XLDocument*                          m_parentDoc {}; /**< A pointer to the parent XLDocument object. >*/
@@ -240,6 +274,9 @@ namespace OpenXLSX
         std::string                          m_xmlID {};     /**< The relationship ID of the XML data. >*/
         XLContentType                        m_xmlType {};   /**< The type represented by the XML data. >*/
         mutable std::unique_ptr<XMLDocument> m_xmlDoc;       /**< The underlying XMLDocument object. >*/
+        mutable std::unique_ptr<XLRowIndex>  m_rowIndex;     /**< Row number -> row node index, only used for worksheets. >*/
+        mutable uint64_t                     m_savedFingerprint {};  /**< fingerprint() of the loaded or last saved document. >*/
+        bool                                 m_rawDataSet {};        /**< true if setRawData replaced the archived content. >*/
     };
 }    // namespace OpenXLSX
 
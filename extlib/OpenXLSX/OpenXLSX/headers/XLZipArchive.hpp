@@ -53,6 +53,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #endif // _MSC_VER
 
 // ===== OpenXLSX Includes ===== //
+#include "IZipArchive.hpp"
 #include "OpenXLSX-Exports.hpp"
 
 namespace Zippy
@@ -132,8 +133,9 @@ namespace OpenXLSX
         /**
          * @brief
          * @param path
+         * @param options see XLZipSaveOptions
          */
-        void save(const std::string& path = "");
+        void save(const std::string& path = "", const XLZipSaveOptions& options = {});
 
         /**
          * @brief
@@ -162,6 +164,21 @@ namespace OpenXLSX
          */
         bool hasEntry(const std::string& entryName) const;
 
+        /**
+         * @brief Open an entry for reading its data in chunks, without extracting it into memory as a whole
+         * @param name The name of the entry
+         * @return An XLZipEntryStream; it must not be used after the archive has been closed or saved
+         */
+        XLZipEntryStream getEntryStream(const std::string& name) const;
+
+        /**
+         * @brief Open an entry for writing its data in chunks, deflating it as it is written
+         * @param name The name of the entry; an existing entry is replaced when the writer is closed
+         * @param options The deflate level is chosen from these options as it would be by save
+         * @return An XLZipEntryWriter; it must not be used after the archive has been closed
+         */
+        std::unique_ptr<XLZipEntryWriter> openEntryWriter(const std::string& name, const XLZipSaveOptions& options);
+
     private:
         std::shared_ptr<Zippy::ZipArchive> m_archive; /**< */
     };
@@ -51,6 +51,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #if defined(_WIN32)
 #    include <random>
 #endif
+#include <memory>         // std::make_shared
 #include <pugixml.hpp>
 #include <sys/stat.h>     // for stat, to test if a file exists and if a file is a directory
 #include <vector>         // std::vector
@@ -60,6 +61,7 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include "XLDocument.hpp"
 #include "XLSheet.hpp"
 #include "XLStyles.hpp"
+#include "XLTrace.hpp"
 #include "utilities/XLUtilities.hpp"
 
 // don't use "stat" directly because windows has compatibility-breaking defines
@@ -470,6 +472,8 @@ void XLDocument::suppressWarnings() { m_suppressWarnings = true; }
  */
 void XLDocument::open(const std::string& fileName)
 {
+    OPENXLSX_TRACE_SCOPE("XLDocument::open", fileName);
+
     // Check if a document is already open. If yes, close it.
     if (m_archive.isOpen()) close(); // TBD: consider throwing if a file is already open.
     m_filePath = fileName;
@@ -599,6 +603,8 @@ void XLDocument::open(const std::string& fileName)
         // ===== Append an empty string even if elem.empty(), to keep the index aligned with the <si> tag index in the shared strings table <sst>
         m_sharedStringCache.emplace_back(result); // 2024-09-01 TBC BUGFIX: previously, a shared strings table entry that had neither <t> nor
         /**/                                      //     <r> nodes would not have appended to m_sharedStringCache, causing an index misalignment
+        // ===== Build the string index once here: try_emplace keeps the first (lowest) index of duplicate strings
+        m_sharedStringIndex.try_emplace(std::string_view(m_sharedStringCache.back()), static_cast<int32_t>(m_sharedStringCache.size() - 1));
 
         node = node.next_sibling_of_type(pugi::node_element);
     }
@@ -619,7 +625,7 @@ void XLDocument::open(const std::string& fileName)
     // ===== 2024-09-02: ensure that all worksheets are contained in app.xml <TitlesOfParts> and reflected in <HeadingPairs> value for Worksheets
     m_appProperties.alignWorksheets(m_workbook.sheetNames());
 
-    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache);
+    m_sharedStrings  = XLSharedStrings(getXmlData("xl/sharedStrings.xml"), &m_sharedStringCache, &m_sharedStringIndex);
     m_styles         = XLStyles(getXmlData("xl/styles.xml"), m_suppressWarnings); // 2024-10-14: forward supress warnings setting to XLStyles
 }
 
@@ -712,6 +718,7 @@ void XLDocument::close()
     m_xmlSavingDeclaration = XLXmlSavingDeclaration();
 
     m_data.clear();
+    m_sharedStringIndex.clear();             // clear before the cache that the index keys refer to
     m_sharedStringCache.clear();             // 2024-12-18 BUGFIX: clear shared strings cache - addresses issue #283
     m_sharedStrings    = XLSharedStrings();  //
 
@@ -728,20 +735,31 @@ void XLDocument::close()
 /**
  * @details Save the document with the same name. The existing file will be overwritten.
  */
-void XLDocument::save() { saveAs(m_filePath, XLForceOverwrite); }
+void XLDocument::save() { saveAs(m_filePath, XLForceOverwrite, m_saveOptions); }
+
+/**
+ * @details
+ */
+void XLDocument::save(const XLZipSaveOptions& options) { saveAs(m_filePath, XLForceOverwrite, options); }
+
+/**
+ * @details
+ */
+void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite) { saveAs(fileName, forceOverwrite, m_saveOptions); }
 
 /**
  * @details Save the document with a new name. If present, the 'calcChain.xml file will be ignored. The reason for this
  * is that changes to the document may invalidate the calcChain.xml file. Deleting will force Excel to re-create the
  * file. This will happen automatically, without the user noticing.
  */
-void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
+void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite, const XLZipSaveOptions& options)
 {
     // 2024-07-26: prevent silent overwriting of existing files
     if (!forceOverwrite && pathExists(fileName)) {
         using namespace std::literals::string_literals;
         throw XLException("XLDocument::saveAs: refusing to overwrite existing file "s + fileName);
     }
+    OPENXLSX_TRACE_SCOPE("XLDocument::saveAs", fileName);
 
     m_filePath = fileName;
 
@@ -749,16 +767,21 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
     // TODO: Is this the best way to do it? Maybe there is a flag that can be set, that forces re-calculalion.
     execCommand(XLCommand(XLCommandType::ResetCalcChain));
 
-    // ===== Add all xml items to archive and save the archive.
+    // ===== Add all modified xml items to archive and save the archive. Unmodified items are copied from the
+    //       source archive as they are, without serializing and recompressing them.
+    std::vector<XLXmlData*> savedItems;
     for (auto& item : m_data) {
+        if (not item.isModified()) continue;
         bool xmlIsStandalone = m_xmlSavingDeclaration.standalone_as_bool();
         if ((item.getXmlPath() == "docProps/core.xml")
           ||(item.getXmlPath() == "docProps/app.xml"))
             xmlIsStandalone = XLXmlStandalone;
         m_archive.addEntry(item.getXmlPath(),
             item.getRawData(XLXmlSavingDeclaration(m_xmlSavingDeclaration.version(), m_xmlSavingDeclaration.encoding(),xmlIsStandalone)));
+        savedItems.push_back(&item);
     }
-    m_archive.save(m_filePath);
+    m_archive.save(m_filePath, options);
+    for (auto* item : savedItems) item->setSaved();
 }
 
 /**
@@ -768,6 +791,16 @@ void XLDocument::saveAs(const std::string& fileName, bool forceOverwrite)
  */
 void XLDocument::saveAs(const std::string& fileName) { saveAs( fileName, XLForceOverwrite ); }
 
+/**
+ * @details
+ */
+void XLDocument::setSaveOptions(const XLZipSaveOptions& options) { m_saveOptions = options; }
+
+/**
+ * @details
+ */
+const XLZipSaveOptions& XLDocument::saveOptions() const { return m_saveOptions; }
+
 /**
  * @details
  */
@@ -1437,6 +1470,24 @@ XLQuery XLDocument::execQuery(const XLQuery& query) const
                 throw XLInternalError("Path does not exist in zip archive (" + query.getParam<std::string>("xmlPath") + ")");
             return XLQuery(query).setResult(&*result);
         }
+
+        case XLQueryType::QueryXmlStream: {
+            // ===== Parts that differ from the archive are serialized, all others are inflated from the archive incrementally
+            const auto& xmlPath = query.getParam<std::string>("xmlPath");
+            const XLXmlData* xmlData = getXmlData(xmlPath, true);
+            if (xmlData != nullptr && xmlData->isModified()) {
+                auto data = std::make_shared<std::string>(xmlData->getRawData());
+                return XLQuery(query).setResult(XLZipEntryStream([data, pos = size_t {0}](char* buffer, size_t size) mutable {
+                    const size_t count = data->copy(buffer, size, pos);
+                    pos += count;
+                    return count;
+                }));
+            }
+            if (not m_archive.hasEntry(xmlPath))
+                throw XLInternalError("Path does not exist in zip archive (" + xmlPath + ")");
+            return XLQuery(query).setResult(m_archive.getEntryStream(xmlPath));
+        }
+
         default:
             throw XLInternalError("XLDocument::execQuery: unknown query type " + std::to_string(static_cast<uint8_t>(query.type())));
     }
@@ -1522,6 +1573,14 @@ std::string XLDocument::extractXmlFromArchive(const std::string& path)
     return (m_archive.hasEntry(path) ? m_archive.getEntry(path) : "");
 }
 
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryWriter> XLDocument::openXmlWriter(const std::string& path)
+{
+    return m_archive.openEntryWriter(path, m_saveOptions);
+}
+
 /**
  * @details
  */
@@ -245,7 +245,7 @@ namespace OpenXLSX
     {
         const auto node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return 0;
-        return XLCellReference(node.attribute("r").value()).column();
+        return getCellColumnNumber(node);
     }
 
     /**
@@ -271,7 +271,7 @@ namespace OpenXLSX
     {
         const XMLNode node = m_rowNode->last_child_of_type(pugi::node_element);
         if (node.empty()) return XLRowDataRange();    // empty range
-        return XLRowDataRange(*m_rowNode, 1, XLCellReference(node.attribute("r").value()).column(), m_sharedStrings.get());
+        return XLRowDataRange(*m_rowNode, 1, getCellColumnNumber(node), m_sharedStrings.get());
     }
 
     /**
@@ -301,15 +301,15 @@ namespace OpenXLSX
         XMLNode cellNode = m_rowNode->last_child_of_type(pugi::node_element);
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+        if (cellNode.empty() || (getCellColumnNumber(cellNode) < columnNumber))
             return XLCell{}; // fail
 
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        if (getCellColumnNumber(cellNode) - columnNumber < columnNumber) {
+            while (not cellNode.empty() && (getCellColumnNumber(cellNode) > columnNumber))
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
             // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber))
+            if (cellNode.empty() || (getCellColumnNumber(cellNode) < columnNumber))
                 return XLCell{}; // fail
         }
         // ===== Otherwise, start from the beginning
@@ -318,10 +318,10 @@ namespace OpenXLSX
             cellNode = m_rowNode->first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            while (getCellColumnNumber(cellNode) < columnNumber)
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
             // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber)
+            if (getCellColumnNumber(cellNode) > columnNumber)
                 return XLCell{}; // fail
         }
         return XLCell(cellNode, m_sharedStrings.get());
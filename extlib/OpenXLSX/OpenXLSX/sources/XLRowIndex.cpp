@@ -0,0 +1,140 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <iterator>    // std::prev
+#include <string>
+
+// ===== OpenXLSX Includes ===== //
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLRowIndex.hpp"
+
+using namespace OpenXLSX;
+
+/**
+ * @details Performs the same range check as the getRowNode utility function, then delegates to locate.
+ */
+XMLNode XLRowIndex::getRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) {
+        using namespace std::literals::string_literals;
+        throw XLCellAddressError("rowNumber "s + std::to_string(rowNumber) + " is outside valid range [1;"s + std::to_string(OpenXLSX::MAX_ROWS) + "]"s);
+    }
+    return locate(sheetDataNode, rowNumber, true);
+}
+
+/**
+ * @details
+ */
+XMLNode XLRowIndex::findRowNode(XMLNode sheetDataNode, uint32_t rowNumber)
+{
+    if (rowNumber < 1 || rowNumber > OpenXLSX::MAX_ROWS) return XMLNode {};
+    return locate(sheetDataNode, rowNumber, false);
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::erase(uint32_t rowNumber) { m_rows.erase(rowNumber); }
+
+/**
+ * @details
+ */
+void XLRowIndex::clear()
+{
+    m_rows.clear();
+    m_sheetDataNode = XMLNode {};
+    m_built         = false;
+}
+
+/**
+ * @details The index entry with the lowest row number >= rowNumber is either the requested row or the nearest
+ * indexed row after it. Between that entry and its indexed predecessor, there may still be rows that were created
+ * by code paths not using the index, so the gap is walked (normally zero steps) before a new row is inserted.
+ */
+XMLNode XLRowIndex::locate(XMLNode sheetDataNode, uint32_t rowNumber, bool createIfMissing)
+{
+    if (not m_built || m_sheetDataNode != sheetDataNode) build(sheetDataNode);
+
+    auto next = m_rows.lower_bound(rowNumber);
+    if (next != m_rows.end() && next->first == rowNumber) {
+        if (next->second.attribute("r").as_ullong() == rowNumber) return next->second;
+        build(sheetDataNode);    // the row was renumbered behind the index's back: start over
+        next = m_rows.lower_bound(rowNumber);
+        if (next != m_rows.end() && next->first == rowNumber) return next->second;
+    }
+
+    // ===== Walk the (usually empty) stretch of unindexed rows between the previous and the next indexed row
+    const XMLNode stop = (next == m_rows.end() ? XMLNode {} : next->second);
+    XMLNode       node = (next == m_rows.begin() ? sheetDataNode.first_child_of_type(pugi::node_element)
+                                                 : std::prev(next)->second.next_sibling_of_type(pugi::node_element));
+    while (not node.empty() && node != stop) {
+        const auto r = node.attribute("r").as_ullong();
+        if (r == rowNumber) return m_rows.emplace_hint(next, rowNumber, node)->second;
+        if (r > rowNumber) break;
+        node = node.next_sibling_of_type(pugi::node_element);
+    }
+
+    if (not createIfMissing) return XMLNode {};
+
+    // ===== node is now the first row after rowNumber, or empty if rowNumber is beyond the last row
+    XMLNode result = (node.empty() ? sheetDataNode.append_child("row") : sheetDataNode.insert_child_before("row", node));
+    result.append_attribute("r") = rowNumber;
+    return m_rows.emplace_hint(next, rowNumber, result)->second;
+}
+
+/**
+ * @details
+ */
+void XLRowIndex::build(XMLNode sheetDataNode)
+{
+    m_rows.clear();
+    for (XMLNode row = sheetDataNode.first_child_of_type(pugi::node_element); not row.empty();
+         row         = row.next_sibling_of_type(pugi::node_element))
+        m_rows.emplace_hint(m_rows.end(), static_cast<uint32_t>(row.attribute("r").as_ullong()), row);
+    m_sheetDataNode = sheetDataNode;
+    m_built         = true;
+}
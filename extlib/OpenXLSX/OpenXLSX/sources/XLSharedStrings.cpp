@@ -63,9 +63,10 @@ using namespace OpenXLSX;
  * @details Constructs a new XLSharedStrings object. Only one (common) object is allowed per XLDocument instance.
  * A filepath to the underlying XML file must be provided.
  */
-XLSharedStrings::XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache)
+XLSharedStrings::XLSharedStrings(XLXmlData* xmlData, std::deque<std::string>* stringCache, XLSharedStringIndex* stringIndex)
     : XLXmlFile(xmlData),
-      m_stringCache(stringCache)
+      m_stringCache(stringCache),
+      m_stringIndex(stringIndex)
 {
     XMLDocument & doc = xmlDocument();
     if (doc.document_element().empty())    // handle a bad (no document element) xl/sharedStrings.xml
@@ -89,12 +90,12 @@ XLSharedStrings::~XLSharedStrings() = default;
 
 /**
  * @details Look up a string index by the string content. If the string does not exist, the returned index is -1.
+ * If the string exists more than once, the lowest index is returned.
  */
 int32_t XLSharedStrings::getStringIndex(const std::string& str) const
 {
-    const auto iter = std::find_if(m_stringCache->begin(), m_stringCache->end(), [&](const std::string& s) { return str == s; });
-
-    return iter == m_stringCache->end() ? -1 : static_cast<int32_t>(std::distance(m_stringCache->begin(), iter));
+    const auto iter = m_stringIndex->find(std::string_view(str));
+    return iter == m_stringIndex->end() ? -1 : iter->second;
 }
 
 /**
@@ -131,6 +132,7 @@ int32_t XLSharedStrings::appendString(const std::string& str) const
         textNode.append_attribute("xml:space").set_value("preserve");    // pull request #161
     textNode.text().set(str.c_str());
     m_stringCache->emplace_back(textNode.text().get());    // index of this element = previous stringCacheSize
+    indexString(m_stringCache->back(), static_cast<int32_t>(stringCacheSize));
 
     return static_cast<int32_t>(stringCacheSize);
 }
@@ -152,7 +154,21 @@ void XLSharedStrings::clearString(int32_t index) const   // 2024-04-30: whitespa
         throw XLInternalError("XLSharedStrings::"s + __func__ + ": index "s + std::to_string(index) + " is out of range"s);
     }
 
-    (*m_stringCache)[index] = "";
+    // ===== Un-index the old content before it is overwritten, as the index key is a view into the cached string
+    std::string& cachedString = (*m_stringCache)[index];
+    const auto indexIter = m_stringIndex->find(std::string_view(cachedString));
+    if (indexIter != m_stringIndex->end() && indexIter->second == index) {
+        m_stringIndex->erase(indexIter);
+        // ===== If the same content is stored at a higher index as well, that index now becomes the lookup result
+        for (size_t pos = static_cast<size_t>(index) + 1; pos < m_stringCache->size(); ++pos) {
+            if ((*m_stringCache)[pos] == cachedString) {
+                m_stringIndex->emplace(std::string_view((*m_stringCache)[pos]), static_cast<int32_t>(pos));
+                break;
+            }
+        }
+    }
+    cachedString = "";
+    indexString(cachedString, index);
     // auto iter            = xmlDocument().document_element().children().begin();
     // std::advance(iter, index);
     // iter->text().set(""); // 2024-04-30: BUGFIX: this was never going to work, <si> entries can be plenty that need to be cleared,
@@ -182,12 +198,27 @@ int32_t XLSharedStrings::rewriteXmlFromCache()
 {
     int32_t writtenStrings = 0;
     xmlDocument().document_element().remove_children();  // clear all existing XML
+    m_stringIndex->clear();                               // keys may refer to strings that were moved from
     for (std::string& s : *m_stringCache) {
         XMLNode textNode = xmlDocument().document_element().append_child("si").append_child("t");
         if ((!s.empty()) && (s.front() == ' ' || s.back() == ' '))
             textNode.append_attribute("xml:space").set_value("preserve");    // preserve spaces at begin/end of string
         textNode.text().set(s.c_str());
+        indexString(s, writtenStrings);
         ++writtenStrings;
     }
     return writtenStrings;
 }
+
+/**
+ * @details Existing entries are never overwritten, so that for duplicate strings the lowest index wins, which matches the
+ *  behavior of a linear search through the cache. A lower index replaces a higher one (clearString can produce this).
+ */
+void XLSharedStrings::indexString(const std::string& str, int32_t index) const
+{
+    const auto [iter, inserted] = m_stringIndex->emplace(std::string_view(str), index);
+    if (!inserted && iter->second > index) {
+        m_stringIndex->erase(iter);
+        m_stringIndex->emplace(std::string_view(str), index);
+    }
+}
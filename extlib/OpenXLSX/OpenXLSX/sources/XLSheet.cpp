@@ -1092,7 +1092,7 @@ XLCellAssignable XLWorksheet::cell(const XLCellReference& ref) const { return ce
  */
 XLCellAssignable XLWorksheet::cell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    const XMLNode rowNode  = getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
+    const XMLNode rowNode  = m_xmlData->rowIndex().getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
     const XMLNode cellNode = getCellNode(rowNode, columnNumber, rowNumber);
     // ===== Move-construct XLCellAssignable from temporary XLCell
     return XLCellAssignable(XLCell(cellNode, parentDoc().sharedStrings()));
@@ -1113,7 +1113,8 @@ XLCellAssignable XLWorksheet::findCell(const XLCellReference& ref) const { retur
  */
 XLCellAssignable XLWorksheet::findCell(uint32_t rowNumber, uint16_t columnNumber) const
 {
-    return XLCellAssignable(XLCell(findCellNode(findRowNode( xmlDocument().document_element().child("sheetData"), rowNumber ), columnNumber), parentDoc().sharedStrings()));
+    const XMLNode rowNode = m_xmlData->rowIndex().findRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
+    return XLCellAssignable(XLCell(findCellNode(rowNode, columnNumber), parentDoc().sharedStrings()));
 }
 
 /**
@@ -1198,10 +1199,55 @@ XLRowRange XLWorksheet::rows(uint32_t firstRow, uint32_t lastRow) const
  */
 XLRow XLWorksheet::row(uint32_t rowNumber) const
 {
-    return XLRow { getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber),
+    return XLRow { m_xmlData->rowIndex().getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber),
                    parentDoc().sharedStrings() };
 }
 
+/**
+ * @details Column styles of the written columns are evaluated in one pass over <cols> for the new cells, instead of
+ * once per new cell.
+ */
+void XLWorksheet::setRowValues(uint32_t rowNumber, uint16_t firstColumn, const std::vector<XLCellValue>& values) const
+{
+    if (values.empty()) return;
+    if (firstColumn < 1 || firstColumn + values.size() - 1 > MAX_COLS) {
+        using namespace std::literals::string_literals;
+        throw XLCellAddressError("setRowValues: columns "s + std::to_string(firstColumn) + " to "s +
+                                 std::to_string(firstColumn + values.size() - 1) + " are outside valid range [1;"s +
+                                 std::to_string(MAX_COLS) + "]"s);
+    }
+    const auto lastColumn = static_cast<uint16_t>(firstColumn + values.size() - 1);
+
+    XMLNode rowNode = m_xmlData->rowIndex().getRowNode(xmlDocument().document_element().child("sheetData"), rowNumber);
+
+    // ===== Walk <cols> backwards, so that the first matching <col> wins as in getColumnStyle
+    std::vector<XLStyleIndex> colStyles(lastColumn, XLDefaultCellFormat);
+    for (XMLNode col = xmlDocument().document_element().child("cols").last_child_of_type(pugi::node_element); not col.empty();
+         col = col.previous_sibling_of_type(pugi::node_element)) {
+        const auto min = std::max<uint32_t>(col.attribute("min").as_uint(MAX_COLS + 1), firstColumn);
+        const auto max = std::min<uint32_t>(col.attribute("max").as_uint(0), lastColumn);
+        for (uint32_t colNo = min; colNo <= max; ++colNo) colStyles[colNo - 1] = col.attribute("style").as_uint(XLDefaultCellFormat);
+    }
+
+    // ===== Skip the cells before firstColumn, then assign the values while walking forward through the row
+    XMLNode cellNode = rowNode.first_child_of_type(pugi::node_element);
+    while (not cellNode.empty() && getCellColumnNumber(cellNode) < firstColumn) cellNode = cellNode.next_sibling_of_type(pugi::node_element);
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        const auto colNo = static_cast<uint16_t>(firstColumn + i);
+        XMLNode    target;
+        if (not cellNode.empty() && getCellColumnNumber(cellNode) == colNo) {
+            target   = cellNode;
+            cellNode = cellNode.next_sibling_of_type(pugi::node_element);
+        }
+        else {
+            target = cellNode.empty() ? rowNode.append_child("c") : rowNode.insert_child_before("c", cellNode);
+            setDefaultCellAttributes(target, XLCellReference(rowNumber, colNo).address(), rowNode, colNo, colStyles);
+        }
+        XLCell(target, parentDoc().sharedStrings()).value() = values[i];
+    }
+}
+
 /**
  * @details Get the XLColumn object corresponding to the given column number. In the underlying XML data structure,
  * column nodes do not hold any cell data. Columns are used solely to hold data regarding column formatting.
@@ -1327,30 +1373,17 @@ uint32_t XLWorksheet::rowCount() const noexcept
 }
 
 /**
- * @details finds a given row and deletes it
+ * @details finds a given row via the row index and deletes it
  */
 bool XLWorksheet::deleteRow(uint32_t rowNumber)
 {
-    XMLNode row = xmlDocument().document_element().child("sheetData").first_child_of_type(pugi::node_element);
-    XMLNode lastRow = xmlDocument().document_element().child("sheetData").last_child_of_type(pugi::node_element);
-
-    // ===== Fail if rowNumber is not in XML
-    if (rowNumber < row.attribute("r").as_ullong() || rowNumber > lastRow.attribute("r").as_ullong()) return false;
-
-    // ===== If rowNumber is closer to first (existing) row than to last row, search forwards
-    if (rowNumber - row.attribute("r").as_ullong() < lastRow.attribute("r").as_ullong() - rowNumber)
-        while (not row.empty() && (row.attribute("r").as_ullong() < rowNumber)) row = row.next_sibling_of_type(pugi::node_element);
-
-    // ===== Otherwise, search backwards
-    else {
-        row = lastRow;
-        while (not row.empty() && (row.attribute("r").as_ullong() > rowNumber)) row = row.previous_sibling_of_type(pugi::node_element);
-    }
-
-    if (row.attribute("r").as_ullong() != rowNumber) return false;    // row not found in XML
+    XMLNode sheetData = xmlDocument().document_element().child("sheetData");
+    XMLNode row       = m_xmlData->rowIndex().findRowNode(sheetData, rowNumber);
+    if (row.empty()) return false;    // row not found in XML
 
-    // ===== If row was located: remove it
-    return xmlDocument().document_element().child("sheetData").remove_child(row);
+    // ===== If row was located: remove it from the index before the node is destroyed, then from the XML
+    m_xmlData->rowIndex().erase(rowNumber);
+    return sheetData.remove_child(row);
 }
 
 /**
@@ -0,0 +1,401 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <algorithm>    // std::max
+#include <cstdlib>    // std::strtod, std::strtoll, std::strtoul
+#include <cstring>    // std::memchr, std::strcmp, std::strlen
+#include <utility>    // std::move
+
+// ===== OpenXLSX Includes ===== //
+#include "XLException.hpp"
+#include "XLStreamingSheetReader.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t streamChunkSize = 65536;    // number of bytes requested from the stream at a time
+
+    /**
+     * @brief Append a UTF-8 encoded code point to a string.
+     */
+    void appendCodePoint(std::string& str, unsigned long codePoint)
+    {
+        if (codePoint < 0x80) {
+            str += static_cast<char>(codePoint);
+        }
+        else if (codePoint < 0x800) {
+            str += static_cast<char>(0xC0 | (codePoint >> 6));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else if (codePoint < 0x10000) {
+            str += static_cast<char>(0xE0 | (codePoint >> 12));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+        else {
+            str += static_cast<char>(0xF0 | (codePoint >> 18));
+            str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * @brief Append character data to a string, replacing the predefined XML entities and character references.
+     * Unknown entities are copied verbatim.
+     */
+    void appendDecoded(std::string& str, const char* first, const char* last)
+    {
+        while (first != last) {
+            const char* amp = static_cast<const char*>(std::memchr(first, '&', static_cast<size_t>(last - first)));
+            if (amp == nullptr) amp = last;
+            str.append(first, amp);
+            if (amp == last) break;
+
+            const char* semicolon = static_cast<const char*>(std::memchr(amp, ';', static_cast<size_t>(last - amp)));
+            if (semicolon == nullptr) {
+                str.append(amp, last);
+                break;
+            }
+
+            const std::string entity(amp + 1, semicolon);
+            if (entity == "lt") str += '<';
+            else if (entity == "gt") str += '>';
+            else if (entity == "amp") str += '&';
+            else if (entity == "quot") str += '"';
+            else if (entity == "apos") str += '\'';
+            else if (entity.size() > 2 && entity[0] == '#' && (entity[1] == 'x' || entity[1] == 'X'))
+                appendCodePoint(str, std::strtoul(entity.c_str() + 2, nullptr, 16));
+            else if (entity.size() > 1 && entity[0] == '#')
+                appendCodePoint(str, std::strtoul(entity.c_str() + 1, nullptr, 10));
+            else
+                str.append(amp, semicolon + 1);
+            first = semicolon + 1;
+        }
+    }
+
+    /**
+     * @brief Get the column number from a cell reference such as "AB12".
+     * @return The column number, or defaultColumn if the reference does not start with a column.
+     */
+    uint16_t columnFromReference(const std::string& reference, uint16_t defaultColumn)
+    {
+        uint32_t column = 0;
+        for (const char ch : reference) {
+            if (ch < 'A' || ch > 'Z') break;
+            column = column * 26 + static_cast<uint32_t>(ch - 'A' + 1);
+            if (column > MAX_COLS) throw XLInternalError("Invalid cell reference " + reference + " in worksheet");
+        }
+        return column == 0 ? defaultColumn : static_cast<uint16_t>(column);
+    }
+
+    /**
+     * @brief Throw the exception used for worksheet XML that ends in the middle of the sheet data.
+     */
+    [[noreturn]] void throwUnexpectedEnd() { throw XLInternalError("Unexpected end of worksheet data"); }
+}    // namespace
+
+/**
+ * @details
+ */
+XLStreamingSheetReader::XLStreamingSheetReader(XLZipEntryStream stream, const XLSharedStrings& sharedStrings)
+    : m_stream(std::move(stream)),
+      m_sharedStrings(sharedStrings)
+{}
+
+/**
+ * @details
+ */
+XLStreamingSheetReader::~XLStreamingSheetReader() = default;
+
+/**
+ * @details Skips everything up to the <sheetData> element, then reads the next <row> element. Cells are placed at the
+ * column given by their reference; cells and rows without a reference follow the previous one.
+ */
+uint32_t XLStreamingSheetReader::nextRow(std::vector<XLCellValue>& values, uint16_t lastColumn)
+{
+    values.clear();
+    if (m_endOfSheetData) return 0;
+
+    for (;;) {
+        TokenType token = nextToken();
+        if (token == TokenType::EndOfData) throwUnexpectedEnd();
+
+        // ===== Skip the worksheet properties preceding the sheet data.
+        if (not m_inSheetData) {
+            if (token == TokenType::StartTag && m_name == "sheetData") {
+                m_inSheetData    = true;
+                m_endOfSheetData = m_selfClosing;
+                if (m_endOfSheetData) return 0;
+            }
+            continue;
+        }
+
+        if (token == TokenType::EndTag && m_name == "sheetData") {
+            m_endOfSheetData = true;
+            return 0;
+        }
+        if (token != TokenType::StartTag || m_name != "row") continue;
+
+        const std::string rowReference = attribute("r");
+        m_rowNumber = rowReference.empty() ? m_rowNumber + 1 : static_cast<uint32_t>(std::strtoul(rowReference.c_str(), nullptr, 10));
+        if (m_selfClosing) return m_rowNumber;
+
+        // ===== Read the cells of the row.
+        uint16_t column = 0;
+        for (token = nextToken(); not(token == TokenType::EndTag && m_name == "row"); token = nextToken()) {
+            if (token == TokenType::EndOfData) throwUnexpectedEnd();
+            if (token != TokenType::StartTag || m_name != "c") continue;
+
+            column = columnFromReference(attribute("r"), column + 1);
+            if (m_selfClosing) {
+                if (column <= lastColumn && values.size() < column) values.resize(column);
+                continue;
+            }
+            if (column > lastColumn) {
+                for (token = nextToken(); not(token == TokenType::EndTag && m_name == "c"); token = nextToken())
+                    if (token == TokenType::EndOfData) throwUnexpectedEnd();
+                continue;
+            }
+
+            XLCellValue value = readCell(attribute("t"));
+            if (values.size() < column) values.resize(column);
+            values[column - 1] = std::move(value);
+        }
+        return m_rowNumber;
+    }
+}
+
+/**
+ * @details
+ */
+bool XLStreamingSheetReader::fill()
+{
+    if (m_endOfStream) return false;
+
+    m_buffer.erase(0, m_pos);
+    m_pos = 0;
+
+    const size_t size = m_buffer.size();
+    m_buffer.resize(size + streamChunkSize);
+    const size_t count = m_stream(m_buffer.data() + size, streamChunkSize);
+    m_buffer.resize(size + count);
+    m_endOfStream = (count == 0);
+    return not m_endOfStream;
+}
+
+/**
+ * @details Offsets are relative to m_pos, so they remain valid when fill discards consumed data.
+ */
+size_t XLStreamingSheetReader::find(const char* str, size_t offset)
+{
+    const size_t length = std::strlen(str);
+    for (;;) {
+        const size_t pos = m_buffer.find(str, m_pos + offset);
+        if (pos != std::string::npos) return pos - m_pos;
+
+        // ===== Only the last length - 1 characters can be the beginning of a match that continues in the next chunk.
+        const size_t available = m_buffer.size() - m_pos;
+        if (available >= length) offset = std::max(offset, available - length + 1);
+        if (not fill()) return std::string::npos;
+    }
+}
+
+/**
+ * @details Processing instructions, comments and document type declarations are skipped. CDATA sections are reported
+ * as text.
+ */
+XLStreamingSheetReader::TokenType XLStreamingSheetReader::nextToken()
+{
+    for (;;) {
+        if (m_pos == m_buffer.size() && not fill()) return TokenType::EndOfData;
+
+        // ===== Character data runs up to the next tag.
+        if (m_buffer[m_pos] != '<') {
+            size_t length = find("<");
+            if (length == std::string::npos) length = m_buffer.size() - m_pos;
+            m_text.clear();
+            appendDecoded(m_text, m_buffer.data() + m_pos, m_buffer.data() + m_pos + length);
+            m_pos += length;
+            return TokenType::Text;
+        }
+
+        // ===== Markup that is not an element.
+        while (m_buffer.size() - m_pos < 9 && fill()) {}    // enough to recognize "<![CDATA["
+        if (m_buffer.size() - m_pos < 2) throwUnexpectedEnd();
+        if (m_buffer[m_pos + 1] == '?' || m_buffer[m_pos + 1] == '!') {
+            const char* terminator = ">";
+            if (m_buffer.compare(m_pos, 2, "<?") == 0) terminator = "?>";
+            else if (m_buffer.compare(m_pos, 4, "<!--") == 0)
+                terminator = "-->";
+            else if (m_buffer.compare(m_pos, 9, "<![CDATA[") == 0)
+                terminator = "]]>";
+
+            const size_t end = find(terminator, 2);
+            if (end == std::string::npos) throwUnexpectedEnd();
+            const bool isCData = (std::strcmp(terminator, "]]>") == 0);
+            if (isCData) m_text.assign(m_buffer, m_pos + 9, end - 9);
+            m_pos += end + std::strlen(terminator);
+            if (isCData) return TokenType::Text;
+            continue;
+        }
+
+        // ===== Find the end of the tag, ignoring '>' characters in attribute values.
+        size_t end   = 1;
+        char   quote = 0;
+        for (;; ++end) {
+            if (m_pos + end == m_buffer.size() && not fill()) throwUnexpectedEnd();
+            const char ch = m_buffer[m_pos + end];
+            if (quote != 0) {
+                if (ch == quote) quote = 0;
+            }
+            else if (ch == '"' || ch == '\'')
+                quote = ch;
+            else if (ch == '>')
+                break;
+        }
+
+        const bool isEndTag = (m_buffer[m_pos + 1] == '/');
+        m_selfClosing       = not isEndTag && m_buffer[m_pos + end - 1] == '/';
+
+        // ===== The tag name, without namespace prefix.
+        const size_t tagEnd    = m_pos + end - (m_selfClosing ? 1 : 0);
+        size_t       nameBegin = m_pos + (isEndTag ? 2 : 1);
+        size_t       nameEnd   = nameBegin;
+        while (nameEnd < tagEnd && m_buffer[nameEnd] != ' ' && m_buffer[nameEnd] != '\t' && m_buffer[nameEnd] != '\r' && m_buffer[nameEnd] != '\n') {
+            if (m_buffer[nameEnd] == ':') nameBegin = nameEnd + 1;
+            ++nameEnd;
+        }
+        m_name.assign(m_buffer, nameBegin, nameEnd - nameBegin);
+        if (not isEndTag) m_attributes.assign(m_buffer, nameEnd, tagEnd - nameEnd);
+
+        m_pos += end + 1;
+        return isEndTag ? TokenType::EndTag : TokenType::StartTag;
+    }
+}
+
+/**
+ * @details
+ */
+std::string XLStreamingSheetReader::attribute(const char* name) const
+{
+    const size_t length = std::strlen(name);
+    size_t       pos    = 0;
+    for (;;) {
+        // ===== Attribute name
+        pos = m_attributes.find_first_not_of(" \t\r\n", pos);
+        if (pos == std::string::npos) return "";
+        const size_t nameEnd = m_attributes.find_first_of("= \t\r\n", pos);
+        if (nameEnd == std::string::npos) return "";
+
+        // ===== Quoted attribute value
+        const size_t valueBegin = m_attributes.find_first_of("\"'", nameEnd);
+        if (valueBegin == std::string::npos) return "";
+        const size_t valueEnd = m_attributes.find(m_attributes[valueBegin], valueBegin + 1);
+        if (valueEnd == std::string::npos) return "";
+
+        if (nameEnd - pos == length && m_attributes.compare(pos, length, name) == 0)
+            return m_attributes.substr(valueBegin + 1, valueEnd - valueBegin - 1);
+        pos = valueEnd + 1;
+    }
+}
+
+/**
+ * @details The value is determined in the same way as by XLCellValueProxy::getValue, except that all text runs of a
+ * rich text inline string are concatenated, and phonetic runs are left out.
+ */
+XLCellValue XLStreamingSheetReader::readCell(const std::string& type)
+{
+    std::string text;
+    bool        hasValue   = false;
+    bool        inText     = false;
+    bool        inPhonetic = false;
+    for (TokenType token = nextToken(); not(token == TokenType::EndTag && m_name == "c"); token = nextToken()) {
+        switch (token) {
+            case TokenType::StartTag:
+                if (m_name == "v" || m_name == "is") hasValue = true;
+                if (m_selfClosing) break;
+                if (m_name == "v" || m_name == "t") inText = not inPhonetic;
+                else if (m_name == "rPh")
+                    inPhonetic = true;
+                break;
+
+            case TokenType::EndTag:
+                if (m_name == "v" || m_name == "t") inText = false;
+                else if (m_name == "rPh")
+                    inPhonetic = false;
+                break;
+
+            case TokenType::Text:
+                if (inText) text += m_text;
+                break;
+
+            default:
+                throwUnexpectedEnd();
+        }
+    }
+
+    // ===== Numbers
+    if (type.empty() || type == "n") {
+        if (not hasValue) return XLCellValue {};
+        if (text.find('.') != std::string::npos || text.find("E-") != std::string::npos || text.find("e-") != std::string::npos)
+            return XLCellValue { std::strtod(text.c_str(), nullptr) };
+        return XLCellValue { static_cast<int64_t>(std::strtoll(text.c_str(), nullptr, 10)) };
+    }
+
+    // ===== Strings
+    if (type == "s") return XLCellValue { m_sharedStrings.get().getString(static_cast<int32_t>(std::strtol(text.c_str(), nullptr, 10))) };
+    if (type == "str" || type == "inlineStr") return XLCellValue { text };
+
+    // ===== Booleans use the same rules as pugi::xml_text::as_bool
+    if (type == "b") {
+        const char first = text.empty() ? '\0' : text.front();
+        return XLCellValue { first == '1' || first == 't' || first == 'T' || first == 'y' || first == 'Y' };
+    }
+
+    return XLCellValue().setError(text);
+}
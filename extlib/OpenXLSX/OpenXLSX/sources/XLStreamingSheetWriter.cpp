@@ -0,0 +1,276 @@
+/*
+
+   ____                               ____      ___ ____       ____  ____      ___
+  6MMMMb                              `MM(      )M' `MM'      6MMMMb\`MM(      )M'
+ 8P    Y8                              `MM.     d'   MM      6M'    ` `MM.     d'
+6M      Mb __ ____     ____  ___  __    `MM.   d'    MM      MM        `MM.   d'
+MM      MM `M6MMMMb   6MMMMb `MM 6MMb    `MM. d'     MM      YM.        `MM. d'
+MM      MM  MM'  `Mb 6M'  `Mb MMM9 `Mb    `MMd       MM       YMMMMb     `MMd
+MM      MM  MM    MM MM    MM MM'   MM     dMM.      MM           `Mb     dMM.
+MM      MM  MM    MM MMMMMMMM MM    MM    d'`MM.     MM            MM    d'`MM.
+YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
+ 8b    d8   MM.  ,M9 YM    d9 MM    MM  d'    `MM.   MM    / L    ,M9  d'    `MM.
+  YMMMM9    MMYMMM9   YMMMM9 _MM_  _MM_M(_    _)MM_ _MMMMMMM MYMMMM9 _M(_    _)MM_
+            MM
+            MM
+           _MM_
+
+  Copyright (c) 2018, Kenneth Troldal Balslev
+
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+  - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+  - Neither the name of the author nor the
+    names of any contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+  ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ */
+
+// ===== External Includes ===== //
+#include <algorithm>    // std::find
+#include <charconv>     // std::to_chars
+#include <pugixml.hpp>
+#include <sstream>
+#include <utility>      // std::move
+
+// ===== OpenXLSX Includes ===== //
+#include "XLConstants.hpp"
+#include "XLException.hpp"
+#include "XLStreamingSheetWriter.hpp"
+#include "XLXmlData.hpp"
+
+using namespace OpenXLSX;
+
+namespace
+{
+    constexpr size_t flushThreshold = 65536;    // number of bytes of XML collected before they are handed to the archive
+
+    /**
+     * @brief Append an integer to a string.
+     */
+    template<typename T>
+    void appendNumber(std::string& str, T value)
+    {
+        char buffer[32];
+        const char* end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        str.append(buffer, static_cast<size_t>(end - buffer));
+    }
+
+    /**
+     * @brief Append a floating point number to a string, in the shortest form that reads back as the same value. A decimal
+     * point is added where needed, so that the value is read back as a float rather than as an integer.
+     */
+    void appendFloat(std::string& str, double value)
+    {
+        char        buffer[32];
+        const char* begin    = buffer;
+        const char* end      = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+        const char* exponent = std::find(begin, end, 'e');
+        if (std::find(begin, exponent, '.') != exponent) {
+            str.append(begin, end);
+            return;
+        }
+        str.append(begin, exponent);
+        str += ".0";
+        str.append(exponent, end);
+    }
+
+    /**
+     * @brief Append the reference of a cell (e.g. "AB12") to a string.
+     */
+    void appendCellReference(std::string& str, uint16_t column, uint32_t row)
+    {
+        char letters[3];
+        int  count = 0;
+        for (uint32_t remainder = column; remainder > 0; remainder = (remainder - 1) / 26)
+            letters[count++] = static_cast<char>('A' + (remainder - 1) % 26);
+        while (count > 0) str += letters[--count];
+        appendNumber(str, row);
+    }
+}    // namespace
+
+/**
+ * @details The worksheet XML is split at the <sheetData> element: the part before it is written immediately, and the
+ * part after it is kept until the writer is closed. The <dimension> element is dropped, since the extent of the data is
+ * only known at the end (the element is optional).
+ */
+XLStreamingSheetWriter::XLStreamingSheetWriter(XLXmlData*                        xmlData,
+                                               std::unique_ptr<XLZipEntryWriter> writer,
+                                               const XLSharedStrings&            sharedStrings,
+                                               XLStringStorage                   stringStorage)
+    : m_xmlData(xmlData),
+      m_writer(std::move(writer)),
+      m_sharedStrings(sharedStrings),
+      m_stringStorage(stringStorage)
+{
+    XMLDocument sheetXml;
+    sheetXml.reset(*m_xmlData->getXmlDocument());
+    XMLNode rootNode = sheetXml.document_element();
+    rootNode.remove_child("dimension");
+    XMLNode sheetDataNode = rootNode.child("sheetData");
+    if (sheetDataNode.empty()) throw XLInternalError("Worksheet XML has no sheetData element");
+    sheetDataNode.remove_children();
+
+    std::ostringstream ostr;
+    sheetXml.save(ostr, "", pugi::format_raw);
+    const std::string xml          = ostr.str();
+    const std::string sheetDataTag = sheetDataNode.name();
+    const std::string emptyElement = "<" + sheetDataTag + "/>";
+    const size_t      pos          = xml.find(emptyElement);
+    if (pos == std::string::npos) throw XLInternalError("Worksheet XML has no sheetData element");
+
+    m_buffer     = xml.substr(0, pos) + "<" + sheetDataTag + ">";
+    m_closingXml = "</" + sheetDataTag + ">" + xml.substr(pos + emptyElement.size());
+}
+
+/**
+ * @details
+ */
+XLStreamingSheetWriter::~XLStreamingSheetWriter() { abort(); }
+
+/**
+ * @details Cells are serialized in the same form as XLCellValueProxy writes them, without a style attribute.
+ */
+void XLStreamingSheetWriter::writeRow(uint32_t rowNumber, const std::vector<XLCellValue>& values, uint16_t firstColumn)
+{
+    if (not m_writer) throw XLInputError("XLStreamingSheetWriter is closed");
+    if (rowNumber > MAX_ROWS) throw XLInputError("Row " + std::to_string(rowNumber) + " exceeds the worksheet rows");
+    if (rowNumber <= m_rowNumber)
+        throw XLInputError("Row " + std::to_string(rowNumber) + " can not be written after row " + std::to_string(m_rowNumber));
+    if (firstColumn < 1 || firstColumn - 1 + values.size() > MAX_COLS) throw XLInputError("Row values exceed the worksheet columns");
+    m_rowNumber = rowNumber;
+
+    m_buffer += "<row r=\"";
+    appendNumber(m_buffer, rowNumber);
+    m_buffer += "\">";
+
+    uint16_t column = firstColumn;
+    for (const auto& value : values) {
+        if (value.type() == XLValueType::Empty) {
+            ++column;
+            continue;
+        }
+
+        m_buffer += "<c r=\"";
+        appendCellReference(m_buffer, column++, rowNumber);
+        switch (value.type()) {
+            case XLValueType::Integer:
+                m_buffer += "\"><v>";
+                appendNumber(m_buffer, value.get<int64_t>());
+                m_buffer += "</v></c>";
+                break;
+
+            case XLValueType::Float:
+                m_buffer += "\"><v>";
+                appendFloat(m_buffer, value.get<double>());
+                m_buffer += "</v></c>";
+                break;
+
+            case XLValueType::Boolean:
+                m_buffer += value.get<bool>() ? "\" t=\"b\"><v>1</v></c>" : "\" t=\"b\"><v>0</v></c>";
+                break;
+
+            case XLValueType::String:
+                if (m_stringStorage == XLStringStorage::SharedStrings) {
+                    const auto  str   = value.get<std::string>();
+                    int32_t     index = m_sharedStrings.get().getStringIndex(str);
+                    if (index < 0) index = m_sharedStrings.get().appendString(str);
+                    m_buffer += "\" t=\"s\"><v>";
+                    appendNumber(m_buffer, index);
+                    m_buffer += "</v></c>";
+                }
+                else {
+                    m_buffer += "\" t=\"inlineStr\"><is><t xml:space=\"preserve\">";
+                    appendEscaped(value.get<std::string>());
+                    m_buffer += "</t></is></c>";
+                }
+                break;
+
+            default:    // XLValueType::Error
+                m_buffer += "\" t=\"e\"><v>";
+                appendEscaped(value.get<std::string>());
+                m_buffer += "</v></c>";
+                break;
+        }
+    }
+    m_buffer += "</row>";
+
+    if (m_buffer.size() >= flushThreshold) flush();
+}
+
+/**
+ * @details
+ */
+void XLStreamingSheetWriter::appendRow(const std::vector<XLCellValue>& values) { writeRow(m_rowNumber + 1, values); }
+
+/**
+ * @details The parsed worksheet (if any) is unloaded, so that it is read back from the new archive entry on next access.
+ */
+void XLStreamingSheetWriter::close()
+{
+    if (not m_writer) return;
+    m_buffer += m_closingXml;
+    flush();
+    m_writer->close();
+    m_writer.reset();
+    m_xmlData->unload();
+}
+
+/**
+ * @details The archive entry is only replaced when the entry writer is closed, so destroying it unclosed drops the
+ * deflated rows. The worksheet XML data was copied on construction and has not been touched.
+ */
+void XLStreamingSheetWriter::abort() noexcept
+{
+    m_writer.reset();
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+}
+
+/**
+ * @details
+ */
+void XLStreamingSheetWriter::appendEscaped(const std::string& text)
+{
+    for (const char ch : text) {
+        switch (ch) {
+            case '&':
+                m_buffer += "&amp;";
+                break;
+            case '<':
+                m_buffer += "&lt;";
+                break;
+            case '>':
+                m_buffer += "&gt;";
+                break;
+            default:
+                m_buffer += ch;
+        }
+    }
+}
+
+/**
+ * @details
+ */
+void XLStreamingSheetWriter::flush()
+{
+    m_writer->write(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
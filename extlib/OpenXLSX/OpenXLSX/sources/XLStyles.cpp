@@ -407,6 +407,91 @@ namespace     // anonymous namespace for module local functions
         }
     }
 
+    /**
+     * @brief Append a canonical text form of node to out: names, attributes and non-whitespace content, recursively.
+     *  Whitespace-only text nodes are skipped, so that entries differing only in indentation compare equal.
+     * @param out the string to append to
+     * @param node the style entry (or one of its children)
+     */
+    void appendCanonicalForm(std::string & out, XMLNode node)
+    {
+        out += node.name();
+        for (XMLAttribute attr = node.first_attribute(); not attr.empty(); attr = attr.next_attribute()) {
+            out += '\0';
+            out += attr.name();
+            out += '=';
+            out += attr.value();
+        }
+        out += '{';
+        for (XMLNode child = node.first_child(); not child.empty(); child = child.next_sibling()) {
+            if (child.type() == pugi::node_element)
+                appendCanonicalForm(out, child);
+            else if (child.type() == pugi::node_pcdata && std::string_view(child.value()).find_first_not_of(" \t\r\n") != std::string_view::npos) {
+                out += '"';
+                out += child.value();
+                out += '"';
+            }
+        }
+        out += '}';
+    }
+
+    /**
+     * @brief Get the canonical form of a style entry, see appendCanonicalForm
+     */
+    std::string canonicalForm(XMLNode node)
+    {
+        std::string result;
+        appendCanonicalForm(result, node);
+        return result;
+    }
+
+    /**
+     * @brief Look up the newest entry of a style collection in its intern table
+     * @param table the intern table of the style collection
+     * @param entryCount the number of entries in the collection, the newest entry being the last one
+     * @param entryNode a callable returning the XML node of the entry at a given index
+     * @return the index of an older entry that is identical to the newest one, or entryCount - 1 if there is none,
+     *  in which case the newest entry has been added to table
+     */
+    template<typename EntryNodeFunc>
+    XLStyleIndex internNewestEntry(XLStyleInternTable & table, size_t entryCount, EntryNodeFunc entryNode)
+    {
+        const XLStyleIndex newest = entryCount - 1;
+        if (table.indexedCount > newest) table = XLStyleInternTable{};    // collection shrank or was replaced: start over
+
+        for (int pass = 0; pass < 2; ++pass) {
+            // ===== Bring the table up to date with entries created through create() since the last call
+            for (; table.indexedCount < newest; ++table.indexedCount)
+                table.indexByForm.try_emplace(canonicalForm(entryNode(table.indexedCount)), table.indexedCount);
+
+            const std::string form = canonicalForm(entryNode(newest));
+            const auto        it   = table.indexByForm.find(form);
+            if (it == table.indexByForm.end()) {
+                table.indexByForm.emplace(form, newest);
+                table.indexedCount = entryCount;
+                return newest;
+            }
+            if (canonicalForm(entryNode(it->second)) == form) return it->second;
+
+            // ===== The existing entry was modified in place since it was indexed: rebuild the table once
+            table = XLStyleInternTable{};
+        }
+        return newest;    // not reached: after a rebuild, a hit is always current
+    }
+
+    /**
+     * @brief Remove the newest entry node of a style collection, together with the whitespace prefix inserted by create
+     * @param collectionNode the parent node of the style entries, e.g. <fonts>
+     * @param entryNode the entry node to remove
+     * @param styleEntriesPrefix the prefix that was passed to create
+     */
+    void removeNewestEntry(XMLNode collectionNode, XMLNode entryNode, std::string const & styleEntriesPrefix)
+    {
+        XMLNode prefixNode = entryNode.previous_sibling();
+        if (styleEntriesPrefix.length() > 0 && prefixNode.type() == pugi::node_pcdata) collectionNode.remove_child(prefixNode);
+        collectionNode.remove_child(entryNode);
+    }
+
    /**
      * @brief Format val as a string with decimalPlaces
      * @param val The value to format
@@ -791,12 +876,14 @@ XLFonts::~XLFonts()
 
 XLFonts::XLFonts(const XLFonts& other)
     : m_fontsNode(std::make_unique<XMLNode>(*other.m_fontsNode)),
-      m_fonts(other.m_fonts)
+      m_fonts(other.m_fonts),
+      m_internTable(other.m_internTable)
 {}
 
 XLFonts::XLFonts(XLFonts&& other)
     : m_fontsNode(std::move(other.m_fontsNode)),
-      m_fonts(std::move(other.m_fonts))
+      m_fonts(std::move(other.m_fonts)),
+      m_internTable(std::move(other.m_internTable))
 {}
 
 
@@ -809,6 +896,7 @@ XLFonts& XLFonts::operator=(const XLFonts& other)
         *m_fontsNode = *other.m_fontsNode;
         m_fonts.clear();
         m_fonts = other.m_fonts;
+        m_internTable = other.m_internTable;
     }
     return *this;
 }
@@ -864,6 +952,23 @@ XLStyleIndex XLFonts::create(XLFont copyFrom, std::string styleEntriesPrefix)
     return index;
 }
 
+/**
+ * @details create the new entry as usual, then drop it again if the intern table knows an identical one
+ */
+XLStyleIndex XLFonts::findOrCreate(XLFont copyFrom, std::function<void(XLFont&)> const& modify, std::string styleEntriesPrefix)
+{
+    const XLStyleIndex index = create(copyFrom, styleEntriesPrefix);
+    if (modify) modify(m_fonts[index]);
+
+    const XLStyleIndex existing = internNewestEntry(m_internTable, m_fonts.size(), [this](XLStyleIndex i) { return *m_fonts[i].m_fontNode; });
+    if (existing == index) return index;
+
+    removeNewestEntry(*m_fontsNode, *m_fonts.back().m_fontNode, styleEntriesPrefix);
+    m_fonts.pop_back();
+    appendAndSetAttribute(*m_fontsNode, "count", std::to_string(m_fonts.size())); // update array count in XML
+    return existing;
+}
+
 
 // ===== XLDataBarColor, used by XLFills gradientFill and by XLLine (to be implemented)
 
@@ -1350,12 +1455,14 @@ XLFills::~XLFills()
 
 XLFills::XLFills(const XLFills& other)
     : m_fillsNode(std::make_unique<XMLNode>(*other.m_fillsNode)),
-      m_fills(other.m_fills)
+      m_fills(other.m_fills),
+      m_internTable(other.m_internTable)
 {}
 
 XLFills::XLFills(XLFills&& other)
     : m_fillsNode(std::move(other.m_fillsNode)),
-      m_fills(std::move(other.m_fills))
+      m_fills(std::move(other.m_fills)),
+      m_internTable(std::move(other.m_internTable))
 {}
 
 
@@ -1368,6 +1475,7 @@ XLFills& XLFills::operator=(const XLFills& other)
         *m_fillsNode = *other.m_fillsNode;
         m_fills.clear();
         m_fills = other.m_fills;
+        m_internTable = other.m_internTable;
     }
     return *this;
 }
@@ -1423,6 +1531,23 @@ XLStyleIndex XLFills::create(XLFill copyFrom, std::string styleEntriesPrefix)
     return index;
 }
 
+/**
+ * @details create the new entry as usual, then drop it again if the intern table knows an identical one
+ */
+XLStyleIndex XLFills::findOrCreate(XLFill copyFrom, std::function<void(XLFill&)> const& modify, std::string styleEntriesPrefix)
+{
+    const XLStyleIndex index = create(copyFrom, styleEntriesPrefix);
+    if (modify) modify(m_fills[index]);
+
+    const XLStyleIndex existing = internNewestEntry(m_internTable, m_fills.size(), [this](XLStyleIndex i) { return *m_fills[i].m_fillNode; });
+    if (existing == index) return index;
+
+    removeNewestEntry(*m_fillsNode, *m_fills.back().m_fillNode, styleEntriesPrefix);
+    m_fills.pop_back();
+    appendAndSetAttribute(*m_fillsNode, "count", std::to_string(m_fills.size())); // update array count in XML
+    return existing;
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLLine object
@@ -1636,12 +1761,14 @@ XLBorders::~XLBorders()
 
 XLBorders::XLBorders(const XLBorders& other)
     : m_bordersNode(std::make_unique<XMLNode>(*other.m_bordersNode)),
-      m_borders(other.m_borders)
+      m_borders(other.m_borders),
+      m_internTable(other.m_internTable)
 {}
 
 XLBorders::XLBorders(XLBorders&& other)
     : m_bordersNode(std::move(other.m_bordersNode)),
-      m_borders(std::move(other.m_borders))
+      m_borders(std::move(other.m_borders)),
+      m_internTable(std::move(other.m_internTable))
 {}
 
 
@@ -1654,6 +1781,7 @@ XLBorders& XLBorders::operator=(const XLBorders& other)
         *m_bordersNode = *other.m_bordersNode;
         m_borders.clear();
         m_borders = other.m_borders;
+        m_internTable = other.m_internTable;
     }
     return *this;
 }
@@ -1709,6 +1837,23 @@ XLStyleIndex XLBorders::create(XLBorder copyFrom, std::string styleEntriesPrefix
     return index;
 }
 
+/**
+ * @details create the new entry as usual, then drop it again if the intern table knows an identical one
+ */
+XLStyleIndex XLBorders::findOrCreate(XLBorder copyFrom, std::function<void(XLBorder&)> const& modify, std::string styleEntriesPrefix)
+{
+    const XLStyleIndex index = create(copyFrom, styleEntriesPrefix);
+    if (modify) modify(m_borders[index]);
+
+    const XLStyleIndex existing = internNewestEntry(m_internTable, m_borders.size(), [this](XLStyleIndex i) { return *m_borders[i].m_borderNode; });
+    if (existing == index) return index;
+
+    removeNewestEntry(*m_bordersNode, *m_borders.back().m_borderNode, styleEntriesPrefix);
+    m_borders.pop_back();
+    appendAndSetAttribute(*m_bordersNode, "count", std::to_string(m_borders.size())); // update array count in XML
+    return existing;
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLAlignment object
@@ -1998,12 +2143,14 @@ XLCellFormats::~XLCellFormats()
 XLCellFormats::XLCellFormats(const XLCellFormats& other)
     : m_cellFormatsNode(std::make_unique<XMLNode>(*other.m_cellFormatsNode)),
       m_cellFormats(other.m_cellFormats),
+      m_internTable(other.m_internTable),
       m_permitXfId(other.m_permitXfId)
 {}
 
 XLCellFormats::XLCellFormats(XLCellFormats&& other)
     : m_cellFormatsNode(std::move(other.m_cellFormatsNode)),
       m_cellFormats(std::move(other.m_cellFormats)),
+      m_internTable(std::move(other.m_internTable)),
       m_permitXfId(other.m_permitXfId)
 {}
 
@@ -2017,6 +2164,7 @@ XLCellFormats& XLCellFormats::operator=(const XLCellFormats& other)
         *m_cellFormatsNode = *other.m_cellFormatsNode;
         m_cellFormats.clear();
         m_cellFormats = other.m_cellFormats;
+        m_internTable = other.m_internTable;
         m_permitXfId = other.m_permitXfId;
     }
     return *this;
@@ -2089,6 +2237,23 @@ XLStyleIndex XLCellFormats::create(XLCellFormat copyFrom, std::string styleEntri
     return index;
 }
 
+/**
+ * @details create the new entry as usual, then drop it again if the intern table knows an identical one
+ */
+XLStyleIndex XLCellFormats::findOrCreate(XLCellFormat copyFrom, std::function<void(XLCellFormat&)> const& modify, std::string styleEntriesPrefix)
+{
+    const XLStyleIndex index = create(copyFrom, styleEntriesPrefix);
+    if (modify) modify(m_cellFormats[index]);
+
+    const XLStyleIndex existing = internNewestEntry(m_internTable, m_cellFormats.size(), [this](XLStyleIndex i) { return *m_cellFormats[i].m_cellFormatNode; });
+    if (existing == index) return index;
+
+    removeNewestEntry(*m_cellFormatsNode, *m_cellFormats.back().m_cellFormatNode, styleEntriesPrefix);
+    m_cellFormats.pop_back();
+    appendAndSetAttribute(*m_cellFormatsNode, "count", std::to_string(m_cellFormats.size())); // update array count in XML
+    return existing;
+}
+
 
 /**
  * @details Constructor. Initializes an empty XLCellStyle object
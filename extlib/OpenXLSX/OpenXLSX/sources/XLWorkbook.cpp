@@ -88,19 +88,39 @@ XLSheet XLWorkbook::sheet(const std::string& sheetName)
         throw XLInputError("Sheet \"" + sheetName + "\" does not exist");
 
     // ===== Find the sheet data corresponding to the sheet with the requested name
-    const std::string xmlID =
-        xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
+    XLQuery xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", sheetXmlPath(sheetName));
+    return XLSheet(parentDoc().execQuery(xmlQuery).result<XLXmlData*>());
+}
 
-    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
-    pathQuery.setParam("sheetID", xmlID);
-    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
+/**
+ * @details The sheet XML is handed to the reader as a stream, so the sheet is neither parsed nor added to the
+ * document's XML data. A sheet that was already loaded and modified is streamed from its current (unsaved) state.
+ */
+XLStreamingSheetReader XLWorkbook::worksheetReader(const std::string& sheetName)
+{
+    if (not worksheetExists(sheetName)) throw XLInputError("Worksheet \"" + sheetName + "\" does not exist");
 
-    // Some spreadsheets use absolute rather than relative paths in relationship items.
-    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
+    XLQuery streamQuery(XLQueryType::QueryXmlStream);
+    streamQuery.setParam("xmlPath", sheetXmlPath(sheetName));
+    return XLStreamingSheetReader(parentDoc().execQuery(streamQuery).result<XLZipEntryStream>(), parentDoc().sharedStrings());
+}
 
-    XLQuery xmlQuery(XLQueryType::QueryXmlData);
-    xmlQuery.setParam("xmlPath", "xl/" + xmlPath);
-    return XLSheet(parentDoc().execQuery(xmlQuery).result<XLXmlData*>());
+/**
+ * @details The rows are serialized straight into a new archive entry for the sheet. The sheet's XML data is unloaded
+ * when the writer is closed, so that the sheet is read back from that entry when it is accessed next.
+ */
+XLStreamingSheetWriter XLWorkbook::worksheetWriter(const std::string& sheetName, XLStringStorage stringStorage)
+{
+    if (not worksheetExists(sheetName)) throw XLInputError("Worksheet \"" + sheetName + "\" does not exist");
+
+    const std::string xmlPath = sheetXmlPath(sheetName);
+    XLQuery           xmlQuery(XLQueryType::QueryXmlData);
+    xmlQuery.setParam("xmlPath", xmlPath);
+    return XLStreamingSheetWriter(parentDoc().execQuery(xmlQuery).result<XLXmlData*>(),
+                                  parentDoc().openXmlWriter(xmlPath),
+                                  parentDoc().sharedStrings(),
+                                  stringStorage);
 }
 
 /**
@@ -269,6 +289,24 @@ uint16_t XLWorkbook::createInternalSheetID()    // 2024-04-30: whitespace suppor
     return maxSheetIdFound + 1;
 }
 
+/**
+ * @details Resolves the sheet's relationship target to the path of its XML part in the archive.
+ */
+std::string XLWorkbook::sheetXmlPath(const std::string& sheetName)
+{
+    const std::string xmlID =
+        xmlDocument().document_element().child("sheets").find_child_by_attribute("name", sheetName.c_str()).attribute("r:id").value();
+
+    XLQuery pathQuery(XLQueryType::QuerySheetRelsTarget);
+    pathQuery.setParam("sheetID", xmlID);
+    auto xmlPath = parentDoc().execQuery(pathQuery).result<std::string>();
+
+    // Some spreadsheets use absolute rather than relative paths in relationship items.
+    if (xmlPath.substr(0, 4) == "/xl/") xmlPath = xmlPath.substr(4);
+
+    return "xl/" + xmlPath;
+}
+
 /**
  * @details
  */
@@ -44,11 +44,14 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
  */
 
 // ===== External Includes ===== //
+#include <functional>     // std::hash
 #include <pugixml.hpp>
 #include <sstream>
+#include <string_view>
 
 // ===== OpenXLSX Includes ===== //
 #include "XLDocument.hpp"
+#include "XLTrace.hpp"
 #include "XLXmlData.hpp"
 
 using namespace OpenXLSX;
@@ -76,7 +79,9 @@ XLXmlData::~XLXmlData() = default;
  */
 void XLXmlData::setRawData(const std::string& data) // NOLINT
 {
+    if (m_rowIndex) m_rowIndex->clear();
     m_xmlDoc->load_string(data.c_str(), pugi_parse_settings);
+    m_rawDataSet = true;
 }
 
 /**
@@ -86,6 +91,7 @@ void XLXmlData::setRawData(const std::string& data) // NOLINT
 std::string XLXmlData::getRawData(XLXmlSavingDeclaration savingDeclaration) const
 {
     XMLDocument *doc = const_cast<XMLDocument *>(getXmlDocument());
+    OPENXLSX_TRACE_SCOPE("XLXmlData::getRawData", m_xmlPath);
 
     // ===== 2024-07-08: ensure that the default encoding UTF-8 is explicitly written to the XML document with a custom saving declaration
     XMLNode saveDeclaration = doc->first_child();
@@ -165,8 +171,12 @@ XLContentType XLXmlData::getXmlType() const
  */
 XMLDocument* XLXmlData::getXmlDocument()
 {
-    if (!m_xmlDoc->document_element())
+    if (!m_xmlDoc->document_element()) {
+        OPENXLSX_TRACE_SCOPE("XLXmlData::getXmlDocument", m_xmlPath);
+        if (m_rowIndex) m_rowIndex->clear();
         m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+        m_savedFingerprint = fingerprint();
+    }
 
     return m_xmlDoc.get();
 }
@@ -176,8 +186,88 @@ XMLDocument* XLXmlData::getXmlDocument()
  */
 const XMLDocument* XLXmlData::getXmlDocument() const
 {
-    if (!m_xmlDoc->document_element())
+    if (!m_xmlDoc->document_element()) {
+        OPENXLSX_TRACE_SCOPE("XLXmlData::getXmlDocument", m_xmlPath);
+        if (m_rowIndex) m_rowIndex->clear();
         m_xmlDoc->load_string(m_parentDoc->extractXmlFromArchive(m_xmlPath).c_str(), pugi_parse_settings);
+        m_savedFingerprint = fingerprint();
+    }
 
     return m_xmlDoc.get();
 }
+
+/**
+ * @details
+ */
+XLRowIndex& XLXmlData::rowIndex()
+{
+    if (!m_rowIndex) m_rowIndex = std::make_unique<XLRowIndex>();
+    return *m_rowIndex;
+}
+
+/**
+ * @details
+ */
+bool XLXmlData::isModified() const
+{
+    if (m_rawDataSet) return true;
+    if (!m_xmlDoc->document_element()) return false;    // never parsed, so never modified
+    return fingerprint() != m_savedFingerprint;
+}
+
+/**
+ * @details
+ */
+void XLXmlData::setSaved()
+{
+    m_savedFingerprint = fingerprint();
+    m_rawDataSet       = false;
+}
+
+/**
+ * @details
+ */
+void XLXmlData::unload()
+{
+    if (m_rowIndex) m_rowIndex->clear();
+    m_xmlDoc->reset();
+    m_savedFingerprint = 0;
+    m_rawDataSet       = false;
+}
+
+/**
+ * @details Walks the document in document order without recursion. Entering and leaving a node are both mixed into
+ * the hash, so that moving a node to a different parent changes the fingerprint.
+ */
+uint64_t XLXmlData::fingerprint() const
+{
+    uint64_t hash    = 0;
+    auto     combine = [&hash](uint64_t value) { hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+    auto     hashStr = [](const char* str) { return static_cast<uint64_t>(std::hash<std::string_view>{}(str)); };
+
+    XMLNode node = m_xmlDoc->first_child();
+    while (not node.empty()) {
+        combine(static_cast<uint64_t>(node.type()));
+        combine(hashStr(node.name()));
+        combine(hashStr(node.value()));
+        for (XMLAttribute attr = node.first_attribute(); not attr.empty(); attr = attr.next_attribute()) {
+            combine(hashStr(attr.name()));
+            combine(hashStr(attr.value()));
+        }
+
+        if (not node.first_child().empty()) {
+            node = node.first_child();
+            continue;
+        }
+        while (not node.empty() && node.next_sibling().empty()) {
+            combine(0xffULL);    // leave node
+            node = node.parent();
+            if (node == *m_xmlDoc) node = XMLNode {};
+        }
+        if (not node.empty()) {
+            combine(0xffULL);
+            node = node.next_sibling();
+        }
+    }
+    return hash;
+}
@@ -47,10 +47,63 @@ YM      M9  MM    MM MM       MM    MM   d'  `MM.    MM            MM   d'  `MM.
 #include <zippy.hpp>
 
 // ===== OpenXLSX Includes ===== //
+#include "XLTrace.hpp"
 #include "XLZipArchive.hpp"
 
 using namespace OpenXLSX;
 
+namespace
+{
+    /**
+     * @brief Match an entry name against a pattern with the wildcards '*' (any sequence, including empty) and '?'
+     * @param name The entry name
+     * @param pattern The pattern
+     * @return true if the pattern matches the whole name
+     */
+    bool matchesPattern(const std::string& name, const std::string& pattern)
+    {
+        size_t n = 0, p = 0;
+        size_t starPos = std::string::npos, starMatch = 0;    // position of the last '*' in pattern, and where it started matching in name
+        while (n < name.size()) {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n])) { ++n; ++p; }
+            else if (p < pattern.size() && pattern[p] == '*') { starPos = p++; starMatch = n; }
+            else if (starPos != std::string::npos) { p = starPos + 1; n = ++starMatch; }    // let the last '*' absorb one more character
+            else return false;
+        }
+        while (p < pattern.size() && pattern[p] == '*') ++p;
+        return p == pattern.size();
+    }
+
+    /**
+     * @brief Determine the deflate level of an entry
+     * @param name The entry name
+     * @param options The save options
+     * @return The level of the first matching pattern in options.entryCompressionLevels, or options.compressionLevel
+     */
+    unsigned int compressionLevel(const std::string& name, const XLZipSaveOptions& options)
+    {
+        for (const auto& [pattern, level] : options.entryCompressionLevels)
+            if (matchesPattern(name, pattern)) return static_cast<unsigned int>(level);
+        return static_cast<unsigned int>(options.compressionLevel);
+    }
+
+    /**
+     * @brief XLZipEntryWriter implementation forwarding to a Zippy::ZipEntryWriter
+     */
+    class ZippyEntryWriter : public XLZipEntryWriter
+    {
+    public:
+        ZippyEntryWriter(Zippy::ZipArchive& archive, const std::string& name, unsigned int level) : m_writer(archive, name, level) {}
+
+        void write(const char* data, size_t size) override { m_writer.Write(data, size); }
+
+        void close() override { m_writer.Close(); }
+
+    private:
+        Zippy::ZipEntryWriter m_writer;
+    };
+}    // anonymous namespace
+
 /**
  * @details
  */
@@ -106,9 +159,13 @@ void XLZipArchive::close()
 /**
  * @details
  */
-void XLZipArchive::save(const std::string& path) // NOLINT
+void XLZipArchive::save(const std::string& path, const XLZipSaveOptions& options) // NOLINT
 {
-    m_archive->Save(path);
+    OPENXLSX_TRACE_SCOPE("XLZipArchive::save", path);
+    m_archive->Save(path,
+                    options.compressionThreads,
+                    [&options](const std::string& entryName) { return compressionLevel(entryName, options); },
+                    options.fullValidation);
 }
 
 /**
@@ -131,6 +188,7 @@ void XLZipArchive::deleteEntry(const std::string& entryName) // NOLINT
  * @details
  */
 std::string XLZipArchive::getEntry(const std::string& name) const {
+    OPENXLSX_TRACE_SCOPE("XLZipArchive::getEntry", name);
     return m_archive->GetEntry(name).GetDataAsString();
 }
 
@@ -140,3 +198,17 @@ std::string XLZipArchive::getEntry(const std::string& name) const {
 bool XLZipArchive::hasEntry(const std::string& entryName) const {
     return m_archive->HasEntry(entryName);
 }
+
+/**
+ * @details
+ */
+XLZipEntryStream XLZipArchive::getEntryStream(const std::string& name) const {
+    return [stream = m_archive->GetEntryStream(name)](char* buffer, size_t size) { return stream(buffer, size); };
+}
+
+/**
+ * @details
+ */
+std::unique_ptr<XLZipEntryWriter> XLZipArchive::openEntryWriter(const std::string& name, const XLZipSaveOptions& options) {
+    return std::make_unique<ZippyEntryWriter>(*m_archive, name, compressionLevel(name, options));
+}
@@ -202,6 +202,25 @@ namespace OpenXLSX
         return result;
     }
 
+    /**
+     * @brief Decode the column number from the "r" attribute of a cell node, without constructing an XLCellReference
+     * @param cellNode a cell (<c>) node
+     * @return the column number of the cell
+     * @throw XLInputError if the attribute does not hold a valid cell address (delegated to XLCellReference)
+     * @note this is called for every sibling skipped while searching a row, so the common case must not allocate
+     */
+    inline uint16_t getCellColumnNumber(XMLNode cellNode)
+    {
+        const char* address = cellNode.attribute("r").value();
+        uint32_t    colNo   = 0;
+        const char* pos     = address;
+        for (; *pos >= 'A' && *pos <= 'Z' && pos - address < 3; ++pos) colNo = colNo * 26 + static_cast<uint32_t>(*pos - 'A' + 1);
+
+        // ===== Fall back to the full parser for anything unusual, so that invalid addresses still throw
+        if (colNo < 1 || colNo > OpenXLSX::MAX_COLS || *pos < '0' || *pos > '9') return XLCellReference(address).column();
+        return static_cast<uint16_t>(colNo);
+    }
+
     /**
      * @brief get the style attribute s for the indicated column, if any is set
      * @param rowNode the row node from which to obtain the parent that should hold the <cols> node
@@ -272,25 +291,25 @@ namespace OpenXLSX
 
         XMLNode cellNode = rowNode.last_child_of_type(pugi::node_element);
         if (!rowNumber) rowNumber = rowNode.attribute("r").as_uint(); // if not provided, determine from rowNode
-        auto cellRef  = XLCellReference(rowNumber, columnNumber);
+        const uint16_t lastColumn = (cellNode.empty() ? 0 : getCellColumnNumber(cellNode));
 
         // ===== If there are no cells in the current row, or the requested cell is beyond the last cell in the row...
-        if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
+        if (cellNode.empty() || (lastColumn < columnNumber)) {
             // ===== append a new node to the end.
             cellNode = rowNode.append_child("c");
-            setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+            setDefaultCellAttributes(cellNode, XLCellReference(rowNumber, columnNumber).address(), rowNode, columnNumber, colStyles);
         }
         // ===== If the requested node is closest to the end, start from the end and search backwards...
-        else if (XLCellReference(cellNode.attribute("r").value()).column() - columnNumber < columnNumber) {
-            while (not cellNode.empty() && (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber))
+        else if (lastColumn - columnNumber < columnNumber) {
+            while (not cellNode.empty() && (getCellColumnNumber(cellNode) > columnNumber))
                 cellNode = cellNode.previous_sibling_of_type(pugi::node_element);
             // ===== If the backwards search failed to locate the requested cell
-            if (cellNode.empty() || (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)) {
+            if (cellNode.empty() || (getCellColumnNumber(cellNode) < columnNumber)) {
                 if (cellNode.empty()) // If between row begin and higher column number, only non-element nodes exist
                     cellNode = rowNode.prepend_child("c"); // insert a new cell node at row begin. When saving, this will keep whitespace formatting towards next cell node
                 else
                     cellNode = rowNode.insert_child_after("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                setDefaultCellAttributes(cellNode, XLCellReference(rowNumber, columnNumber).address(), rowNode, columnNumber, colStyles);
             }
         }
         // ===== Otherwise, start from the beginning
@@ -299,12 +318,12 @@ namespace OpenXLSX
             cellNode = rowNode.first_child_of_type(pugi::node_element);
 
             // ===== It has been verified above that the requested columnNumber is <= the column number of the last node_element, therefore this loop will halt:
-            while (XLCellReference(cellNode.attribute("r").value()).column() < columnNumber)
+            while (getCellColumnNumber(cellNode) < columnNumber)
                 cellNode = cellNode.next_sibling_of_type(pugi::node_element);
             // ===== If the forwards search failed to locate the requested cell
-            if (XLCellReference(cellNode.attribute("r").value()).column() > columnNumber) {
+            if (getCellColumnNumber(cellNode) > columnNumber) {
                 cellNode = rowNode.insert_child_before("c", cellNode);
-                setDefaultCellAttributes(cellNode, cellRef.address(), rowNode, columnNumber, colStyles);
+                setDefaultCellAttributes(cellNode, XLCellReference(rowNumber, columnNumber).address(), rowNode, columnNumber, colStyles);
             }
         }
         return cellNode;
@@ -194,4 +194,142 @@ TEST_CASE("XLDocument Tests", "[XLDocument]")
     //        const XLDocument doc(file);
     //        REQUIRE(doc.name() == file);
     //    }
-}
\ No newline at end of file
+}
+/**
+ * @brief Test that saving only rewrites modified parts, and that untouched parts survive the save unchanged.
+ */
+TEST_CASE("XLDocument Save Tests", "[XLDocument]")
+{
+    std::string file = "./testXLDocumentSave.xlsx";
+
+    {
+        XLDocument doc;
+        doc.create(file, XLForceOverwrite);
+        doc.workbook().addWorksheet("Sheet2");
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = 1;
+        doc.workbook().worksheet("Sheet2").cell("B2").value() = "untouched";
+        doc.save();
+        doc.close();
+    }
+
+    SECTION("Modify one sheet, save twice and reopen")
+    {
+        XLDocument doc;
+        doc.open(file);
+        auto wks1 = doc.workbook().worksheet("Sheet1");
+        auto wks2 = doc.workbook().worksheet("Sheet2");
+        REQUIRE(wks2.cell("B2").value().get<std::string>() == "untouched");    // parsed, but not modified
+
+        wks1.cell("A1").value() = 2;
+        doc.save();
+        wks1.cell("A2").value() = 3;    // modified again after the first save
+        doc.save();
+        doc.close();
+
+        doc.open(file);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<int>() == 2);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A2").value().get<int>() == 3);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<std::string>() == "untouched");
+        doc.close();
+    }
+
+    SECTION("Save an unmodified document under a new name")
+    {
+        std::string newfile = "./testXLDocumentSaveCopy.xlsx";
+        XLDocument  doc;
+        doc.open(file);
+        doc.saveAs(newfile, XLForceOverwrite);
+        doc.close();
+
+        doc.open(newfile);
+        REQUIRE(doc.workbook().worksheetNames().size() == 2);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<int>() == 1);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<std::string>() == "untouched");
+        doc.close();
+    }
+
+    SECTION("Save with parallel compression")
+    {
+        XLDocument doc;
+        doc.open(file);
+        for (int i = 3; i <= 8; ++i) doc.workbook().addWorksheet("Sheet" + std::to_string(i));
+        for (auto& name : doc.workbook().worksheetNames()) {
+            auto wks = doc.workbook().worksheet(name);
+            for (auto& row : wks.rows(500)) row.values() = std::vector<int>(10, static_cast<int>(row.rowNumber()));
+        }
+        XLZipSaveOptions options;
+        options.compressionThreads = 4;
+        doc.save(options);
+        doc.close();
+
+        doc.open(file);
+        REQUIRE(doc.workbook().worksheetCount() == 8);
+        for (auto& name : doc.workbook().worksheetNames()) {
+            auto wks = doc.workbook().worksheet(name);
+            REQUIRE(wks.rowCount() == 500);
+            REQUIRE(wks.cell("J500").value().get<int>() == 500);
+        }
+        doc.close();
+    }
+
+    SECTION("Save with compression levels")
+    {
+        auto fileSize = [](const std::string& path) { return static_cast<size_t>(std::ifstream(path, std::ios::binary | std::ios::ate).tellg()); };
+
+        XLDocument doc;
+        doc.open(file);
+        auto wks = doc.workbook().worksheet("Sheet1");
+        for (auto& row : wks.rows(2000)) row.values() = std::vector<int>(10, 42);
+
+        XLZipSaveOptions options;
+        options.compressionLevel = XLCompressionLevel::Store;
+        doc.setSaveOptions(options);
+        REQUIRE(doc.saveOptions().compressionLevel == XLCompressionLevel::Store);
+        doc.save();
+        const size_t storedSize = fileSize(file);
+
+        wks.cell("A1").value() = 1;
+        options.entryCompressionLevels = {{"xl/worksheets/*.xml", XLCompressionLevel::Max}};
+        doc.save(options);    // per entry pattern overrides the document level
+        const size_t overriddenSize = fileSize(file);
+        REQUIRE(overriddenSize < storedSize);
+
+        wks.cell("A1").value() = 2;
+        doc.save();    // back to the document options
+        REQUIRE(fileSize(file) > overriddenSize);
+        doc.close();
+
+        doc.open(file);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<int>() == 2);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("J2000").value().get<int>() == 42);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<std::string>() == "untouched");
+        doc.close();
+    }
+
+    SECTION("Keep using the document after saving")
+    {
+        XLDocument doc;
+        doc.open(file);
+        auto wks1 = doc.workbook().worksheet("Sheet1");
+        wks1.cell("A1").value() = 2;
+        doc.save();
+
+        // ===== Sheet2 was not parsed before the save, so it is extracted from the newly written archive
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<std::string>() == "untouched");
+
+        wks1.cell("A2").value() = 3;
+        XLZipSaveOptions options;
+        options.fullValidation = true;
+        doc.save(options);
+        wks1.cell("A3").value() = 4;
+        doc.save();
+        doc.close();
+
+        doc.open(file);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<int>() == 2);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A2").value().get<int>() == 3);
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A3").value().get<int>() == 4);
+        REQUIRE(doc.workbook().worksheet("Sheet2").cell("B2").value().get<std::string>() == "untouched");
+        doc.close();
+    }
+}
@@ -0,0 +1,92 @@
+#include <OpenXLSX.hpp>
+#include <algorithm>
+#include <catch.hpp>
+#include <vector>
+
+using namespace OpenXLSX;
+
+namespace
+{
+    std::vector<uint32_t> rowNumbersInXml(const XLWorksheet& wks)
+    {
+        std::vector<uint32_t> result;
+        auto                  rows = wks.rows();
+        for (auto it = rows.begin(); it != rows.end(); ++it)    // rowExists() does not create missing rows
+            if (it.rowExists()) result.push_back(it->rowNumber());
+        return result;
+    }
+}    // namespace
+
+TEST_CASE("XLRowIndex Tests", "[XLRowIndex]")
+{
+    SECTION("Rows created out of order end up sorted")
+    {
+        XLDocument doc;
+        doc.create("./testXLRowIndex.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+
+        for (uint32_t r : { 50, 10, 30, 20, 40, 1, 60 }) wks.cell(r, 1).value() = static_cast<int64_t>(r);
+
+        REQUIRE(rowNumbersInXml(wks) == std::vector<uint32_t> { 1, 10, 20, 30, 40, 50, 60 });
+        REQUIRE(wks.cell(30, 1).value().get<int64_t>() == 30);
+        REQUIRE(wks.row(40).rowNumber() == 40);
+        REQUIRE(wks.findCell(25, 1).empty());
+        REQUIRE(rowNumbersInXml(wks).size() == 7);    // findCell must not create row 25
+    }
+
+    SECTION("Rows created by iterators are picked up by the index")
+    {
+        XLDocument doc;
+        doc.create("./testXLRowIndex.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+
+        wks.cell(1, 1).value() = 1;
+        wks.cell(10, 1).value() = 10;    // index now knows rows 1 and 10
+        for (auto& row : wks.rows(2, 9)) row.values() = std::vector<int> { 7 };    // creates rows 2..9 without the index
+
+        wks.cell(5, 2).value() = 55;
+        REQUIRE(rowNumbersInXml(wks) == std::vector<uint32_t> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 });
+        REQUIRE(wks.cell(5, 1).value().get<int64_t>() == 7);
+        REQUIRE(wks.cell(5, 2).value().get<int64_t>() == 55);
+    }
+
+    SECTION("deleteRow keeps the index consistent")
+    {
+        XLDocument doc;
+        doc.create("./testXLRowIndex.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+
+        for (uint32_t r = 1; r <= 5; ++r) wks.cell(r, 1).value() = static_cast<int64_t>(r);
+
+        REQUIRE(wks.deleteRow(3));
+        REQUIRE_FALSE(wks.deleteRow(3));
+        REQUIRE_FALSE(wks.deleteRow(100));
+        REQUIRE(wks.findCell(3, 1).empty());
+
+        wks.cell(3, 1).value() = 33;    // recreated at the right position
+        REQUIRE(rowNumbersInXml(wks) == std::vector<uint32_t> { 1, 2, 3, 4, 5 });
+        REQUIRE(wks.cell(3, 1).value().get<int64_t>() == 33);
+    }
+
+    SECTION("Index is rebuilt for a reopened document")
+    {
+        {
+            XLDocument doc;
+            doc.create("./testXLRowIndex.xlsx", XLForceOverwrite);
+            XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+            for (int r = 1000; r >= 1; r -= 3) wks.cell(static_cast<uint32_t>(r), 2).value() = static_cast<int64_t>(r);
+            doc.save();
+        }
+
+        XLDocument doc;
+        doc.open("./testXLRowIndex.xlsx");
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell(499, 2).value().get<int64_t>() == 499);
+        REQUIRE(wks.findCell(500, 2).empty());
+        wks.cell(500, 2).value() = 500;
+        REQUIRE(wks.rowCount() == 1000);
+        REQUIRE(wks.cell(500, 2).value().get<int64_t>() == 500);
+        const auto rows = rowNumbersInXml(wks);
+        REQUIRE(std::is_sorted(rows.begin(), rows.end()));
+    }
+}
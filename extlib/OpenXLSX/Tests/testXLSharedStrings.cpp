@@ -0,0 +1,92 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+#include <string>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLSharedStrings Tests", "[XLSharedStrings]")
+{
+    SECTION("Identical strings share one index")
+    {
+        XLDocument doc;
+        doc.create("./testXLSharedStrings.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        const XLSharedStrings& sharedStrings = doc.sharedStrings();
+
+        const int32_t initialCount = sharedStrings.stringCount();
+        wks.cell("A1").value() = "alpha";
+        wks.cell("A2").value() = "beta";
+        wks.cell("A3").value() = "alpha";
+
+        REQUIRE(sharedStrings.stringCount() == initialCount + 2);
+        REQUIRE(sharedStrings.stringExists("alpha"));
+        REQUIRE(std::string(sharedStrings.getString(sharedStrings.getStringIndex("alpha"))) == "alpha");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "alpha");
+        REQUIRE(wks.cell("A3").value().get<std::string>() == "alpha");
+        REQUIRE(sharedStrings.getStringIndex("gamma") == -1);
+    }
+
+    SECTION("Index is kept in sync by appendString and clearString")
+    {
+        XLDocument doc;
+        doc.create("./testXLSharedStrings.xlsx", XLForceOverwrite);
+        const XLSharedStrings& sharedStrings = doc.sharedStrings();
+
+        const int32_t first  = sharedStrings.appendString("one");
+        const int32_t second = sharedStrings.appendString("two");
+        const int32_t copy   = sharedStrings.appendString("one");    // duplicates resolve to the lowest index
+        REQUIRE(sharedStrings.getStringIndex("one") == first);
+        REQUIRE(sharedStrings.getStringIndex("two") == second);
+
+        sharedStrings.clearString(second);
+        REQUIRE(sharedStrings.getStringIndex("two") == -1);
+        REQUIRE(sharedStrings.stringExists(""));
+
+        sharedStrings.clearString(first);
+        REQUIRE(sharedStrings.getStringIndex("one") == copy);
+    }
+
+    SECTION("Index is rebuilt when a document is opened")
+    {
+        {
+            XLDocument doc;
+            doc.create("./testXLSharedStrings.xlsx", XLForceOverwrite);
+            XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+            for (int i = 1; i <= 100; ++i) wks.cell(i, 1).value() = "string " + std::to_string(i);
+            doc.save();
+        }
+
+        XLDocument doc;
+        doc.open("./testXLSharedStrings.xlsx");
+        const XLSharedStrings& sharedStrings = doc.sharedStrings();
+        const int32_t count = sharedStrings.stringCount();
+        for (int i = 1; i <= 100; ++i) {
+            const int32_t index = sharedStrings.getStringIndex("string " + std::to_string(i));
+            REQUIRE(index >= 0);
+            REQUIRE(std::string(sharedStrings.getString(index)) == "string " + std::to_string(i));
+        }
+
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("B1").value() = "string 50";
+        REQUIRE(sharedStrings.stringCount() == count);
+    }
+
+    SECTION("Index survives cleanupSharedStrings")
+    {
+        XLDocument doc;
+        doc.create("./testXLSharedStrings.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        const XLSharedStrings& sharedStrings = doc.sharedStrings();
+
+        wks.cell("A1").value() = "unused";
+        wks.cell("A2").value() = "kept";
+        wks.cell("A1").value() = 1;
+        doc.cleanupSharedStrings();
+
+        REQUIRE(sharedStrings.getStringIndex("unused") == -1);
+        const int32_t kept = sharedStrings.getStringIndex("kept");
+        REQUIRE(kept >= 0);
+        REQUIRE(std::string(sharedStrings.getString(kept)) == "kept");
+        REQUIRE(wks.cell("A2").value().get<std::string>() == "kept");
+    }
+}
@@ -3,7 +3,9 @@
 //
 
 #include <OpenXLSX.hpp>
+#include <algorithm>
 #include <catch.hpp>
+#include <vector>
 
 using namespace OpenXLSX;
 
@@ -74,4 +76,45 @@ TEST_CASE("XLSheet Tests", "[XLSheet]")
 
         doc.save();
     }
+
+    SECTION("XLWorksheet setRowValues") {
+
+        XLDocument doc;
+        doc.create("./testXLSheet3.xlsx", XLForceOverwrite);
+        auto wks = doc.workbook().worksheet("Sheet1");
+
+        // ===== Existing cells before, inside and after the written columns, with a gap at column 4
+        wks.cell(2, 1).value() = "keep";
+        wks.cell(2, 3).value() = "old";
+        wks.cell(2, 5).value() = "old";
+        wks.cell(2, 8).value() = "keep";
+        wks.column(4).setFormat(3);
+
+        wks.setRowValues(2, 2, std::vector<XLCellValue> { XLCellValue(1), XLCellValue("b"), XLCellValue(2.5), XLCellValue(true), XLCellValue() });
+
+        REQUIRE(wks.cell(2, 1).value().get<std::string>() == "keep");
+        REQUIRE(wks.cell(2, 2).value().get<int64_t>() == 1);
+        REQUIRE(wks.cell(2, 3).value().get<std::string>() == "b");
+        REQUIRE(wks.cell(2, 4).value().get<double>() == 2.5);
+        REQUIRE(wks.cell(2, 4).cellFormat() == 3);    // new cells pick up the column style
+        REQUIRE(wks.cell(2, 5).value().get<bool>() == true);
+        REQUIRE(wks.cell(2, 6).value().type() == XLValueType::Empty);
+        REQUIRE(wks.cell(2, 8).value().get<std::string>() == "keep");
+
+        // ===== Cells stay in column order within the row
+        std::vector<uint16_t> columns;
+        for (auto& cell : wks.row(2).cells()) columns.push_back(cell.cellReference().column());
+        REQUIRE(std::is_sorted(columns.begin(), columns.end()));
+        REQUIRE(std::adjacent_find(columns.begin(), columns.end()) == columns.end());
+
+        // ===== A new row is created at its position
+        wks.setRowValues(1, 1, std::vector<XLCellValue> { XLCellValue("first") });
+        REQUIRE(wks.row(1).rowNumber() == 1);
+        REQUIRE(wks.cell("A1").value().get<std::string>() == "first");
+
+        REQUIRE_THROWS_AS(wks.setRowValues(1, MAX_COLS, std::vector<XLCellValue> { XLCellValue(1), XLCellValue(2) }), XLCellAddressError);
+        REQUIRE_THROWS_AS(wks.setRowValues(MAX_ROWS + 1, 1, std::vector<XLCellValue> { XLCellValue(1) }), XLCellAddressError);
+
+        doc.save();
+    }
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStreamingSheetReader Tests", "[XLStreamingSheetReader]")
+{
+    SECTION("Read values of all types")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetReader.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = 42;
+        wks.cell("B1").value() = 3.5;
+        wks.cell("C1").value() = true;
+        wks.cell("D1").value() = "Fish & <Chips>";
+        wks.cell("F1").value().setError("#N/A");
+        wks.cell("B3").value() = -7;
+        wks.cell("C3").formula() = "SUM(1,2)";
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLStreamingSheetReader.xlsx");
+        auto                     reader = doc.workbook().worksheetReader("Sheet1");
+        std::vector<XLCellValue> values;
+
+        REQUIRE(reader.nextRow(values) == 1);
+        REQUIRE(values.size() == 6);
+        REQUIRE(values[0].get<int64_t>() == 42);
+        REQUIRE(values[1].get<double>() == Approx(3.5));
+        REQUIRE(values[2].get<bool>() == true);
+        REQUIRE(values[3].get<std::string>() == "Fish & <Chips>");
+        REQUIRE(values[4].type() == XLValueType::Empty);
+        REQUIRE(values[5].type() == XLValueType::Error);
+
+        REQUIRE(reader.nextRow(values) == 3);
+        REQUIRE(values.size() == 3);
+        REQUIRE(values[0].type() == XLValueType::Empty);
+        REQUIRE(values[1].get<int64_t>() == -7);
+        REQUIRE(values[2] == XLCellValue(doc.workbook().worksheet("Sheet1").cell("C3").value()));    // formula without cached value
+
+        REQUIRE(reader.nextRow(values) == 0);
+        REQUIRE(values.empty());
+        REQUIRE(reader.nextRow(values) == 0);
+        doc.close();
+    }
+
+    SECTION("Values match the worksheet")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetReader.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        for (uint32_t row = 1; row <= 3000; ++row) {    // well beyond one chunk of XML
+            wks.cell(row, 1).value() = static_cast<int64_t>(row);
+            wks.cell(row, 2).value() = "Row " + std::to_string(row % 100);
+            wks.cell(row, 3).value() = row / 8.0;
+        }
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLStreamingSheetReader.xlsx");
+        auto                     reader = doc.workbook().worksheetReader("Sheet1");
+        std::vector<XLCellValue> values;
+        uint32_t                 rowCount = 0;
+        wks                               = doc.workbook().worksheet("Sheet1");
+        for (uint32_t row = reader.nextRow(values); row != 0; row = reader.nextRow(values)) {
+            ++rowCount;
+            REQUIRE(row == rowCount);
+            REQUIRE(values.size() == 3);
+            REQUIRE(values[0] == XLCellValue(wks.cell(row, 1).value()));
+            REQUIRE(values[1] == XLCellValue(wks.cell(row, 2).value()));
+            REQUIRE(values[2] == XLCellValue(wks.cell(row, 3).value()));
+        }
+        REQUIRE(rowCount == 3000);
+        doc.close();
+    }
+
+    SECTION("Cells beyond the last column are skipped")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetReader.xlsx", XLForceOverwrite);
+        XLWorksheet wks = doc.workbook().worksheet("Sheet1");
+        wks.cell("A1").value() = 1;
+        wks.cell("B1").value() = 2;
+        wks.cell("C1").value() = 3;
+        wks.cell("C2").value() = 4;
+        doc.save();
+
+        auto                     reader = doc.workbook().worksheetReader("Sheet1");
+        std::vector<XLCellValue> values;
+        REQUIRE(reader.nextRow(values, 2) == 1);
+        REQUIRE(values.size() == 2);
+        REQUIRE(reader.nextRow(values, 2) == 2);
+        REQUIRE(values.empty());
+        REQUIRE(reader.nextRow(values, 2) == 0);
+        doc.close();
+    }
+
+    SECTION("Unsaved changes are visible to the reader")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetReader.xlsx", XLForceOverwrite);
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = "saved";
+        doc.save();
+
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = "unsaved";
+        doc.workbook().worksheet("Sheet1").cell("A2").value() = 2;
+
+        auto                     reader = doc.workbook().worksheetReader("Sheet1");
+        std::vector<XLCellValue> values;
+        REQUIRE(reader.nextRow(values) == 1);
+        REQUIRE(values[0].get<std::string>() == "unsaved");
+        REQUIRE(reader.nextRow(values) == 2);
+        REQUIRE(values[0].get<int64_t>() == 2);
+        REQUIRE(reader.nextRow(values) == 0);
+        doc.close();
+    }
+
+    SECTION("Only worksheets can be read")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetReader.xlsx", XLForceOverwrite);
+        REQUIRE_THROWS_AS(doc.workbook().worksheetReader("NoSuchSheet"), XLInputError);
+        doc.close();
+    }
+}
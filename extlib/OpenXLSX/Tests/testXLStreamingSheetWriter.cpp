@@ -0,0 +1,136 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStreamingSheetWriter Tests", "[XLStreamingSheetWriter]")
+{
+    SECTION("Write values of all types")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetWriter.xlsx", XLForceOverwrite);
+        {
+            auto writer = doc.workbook().worksheetWriter("Sheet1");
+            writer.appendRow({ XLCellValue(42), XLCellValue(3.5), XLCellValue(true), XLCellValue("Fish & <Chips>"), XLCellValue(), XLCellValue(2.0) });
+            writer.writeRow(3, { XLCellValue(-7), XLCellValue(1e20) }, 2);
+            REQUIRE(writer.rowNumber() == 3);
+            writer.close();
+        }
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLStreamingSheetWriter.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A1").value().get<int64_t>() == 42);
+        REQUIRE(wks.cell("B1").value().get<double>() == Approx(3.5));
+        REQUIRE(wks.cell("C1").value().get<bool>() == true);
+        REQUIRE(wks.cell("D1").value().get<std::string>() == "Fish & <Chips>");
+        REQUIRE(wks.findCell(1, 5).empty());
+        REQUIRE(wks.cell("F1").value().type() == XLValueType::Float);
+        REQUIRE(wks.findCell(2, 1).empty());
+        REQUIRE(wks.cell("B3").value().get<int64_t>() == -7);
+        REQUIRE(wks.cell("C3").value().get<double>() == Approx(1e20));
+        REQUIRE(doc.sharedStrings().stringExists("Fish & <Chips>"));
+        doc.close();
+    }
+
+    SECTION("Inline strings do not grow the shared strings")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetWriter.xlsx", XLForceOverwrite);
+        const auto stringCount = doc.sharedStrings().stringCount();
+        {
+            auto writer = doc.workbook().worksheetWriter("Sheet1", XLStringStorage::InlineStrings);
+            writer.appendRow({ XLCellValue(" padded "), XLCellValue("a & b") });
+            writer.close();
+        }
+        REQUIRE(doc.sharedStrings().stringCount() == stringCount);
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLStreamingSheetWriter.xlsx");
+        auto wks = doc.workbook().worksheet("Sheet1");
+        REQUIRE(wks.cell("A1").value().get<std::string>() == " padded ");
+        REQUIRE(wks.cell("B1").value().get<std::string>() == "a & b");
+        doc.close();
+    }
+
+    SECTION("Rows are replaced, other worksheet content is kept")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetWriter.xlsx", XLForceOverwrite);
+        doc.workbook().addWorksheet("Data");
+        auto wks = doc.workbook().worksheet("Data");
+        wks.cell("Z99").value() = "old";
+        wks.column(2).setWidth(30);
+
+        auto writer = doc.workbook().worksheetWriter("Data");
+        for (int row = 0; row < 5000; ++row) writer.appendRow({ XLCellValue(row), XLCellValue("Row " + std::to_string(row % 50)) });
+        writer.close();
+
+        // ===== The new rows are visible before saving, through the DOM and through a streaming reader
+        wks = doc.workbook().worksheet("Data");
+        REQUIRE(wks.findCell(99, 26).empty());
+        REQUIRE(wks.cell(5000, 1).value().get<int64_t>() == 4999);
+        REQUIRE(wks.column(2).width() == Approx(30));
+
+        std::vector<XLCellValue> values;
+        auto                     reader = doc.workbook().worksheetReader("Data");
+        uint32_t                 rows   = 0;
+        while (reader.nextRow(values) != 0) ++rows;
+        REQUIRE(rows == 5000);
+
+        doc.save();
+        doc.close();
+        doc.open("./testXLStreamingSheetWriter.xlsx");
+        REQUIRE(doc.workbook().worksheet("Data").cell(4321, 2).value().get<std::string>() == "Row 20");
+        doc.close();
+    }
+
+    SECTION("A writer that is not closed leaves the worksheet unchanged")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetWriter.xlsx", XLForceOverwrite);
+        doc.workbook().worksheet("Sheet1").cell("A1").value() = "original";
+        doc.save();
+
+        try {
+            auto writer = doc.workbook().worksheetWriter("Sheet1");
+            writer.appendRow({ XLCellValue("partial") });
+            writer.writeRow(MAX_ROWS + 1, { XLCellValue(1) });
+            writer.close();
+        }
+        catch (const XLInputError&) {}
+
+        {
+            auto writer = doc.workbook().worksheetWriter("Sheet1");
+            writer.appendRow({ XLCellValue("aborted") });
+            writer.abort();
+            writer.close();
+        }
+
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "original");
+        doc.save();
+        doc.close();
+
+        doc.open("./testXLStreamingSheetWriter.xlsx");
+        REQUIRE(doc.workbook().worksheet("Sheet1").cell("A1").value().get<std::string>() == "original");
+        doc.close();
+    }
+
+    SECTION("Rows must be written in ascending order")
+    {
+        XLDocument doc;
+        doc.create("./testXLStreamingSheetWriter.xlsx", XLForceOverwrite);
+        auto writer = doc.workbook().worksheetWriter("Sheet1");
+        writer.writeRow(5, { XLCellValue(1) });
+        REQUIRE_THROWS_AS(writer.writeRow(5, { XLCellValue(1) }), XLInputError);
+        REQUIRE_THROWS_AS(writer.writeRow(2, { XLCellValue(1) }), XLInputError);
+        writer.close();
+        REQUIRE_THROWS_AS(writer.appendRow({ XLCellValue(1) }), XLInputError);
+        REQUIRE_THROWS_AS(doc.workbook().worksheetWriter("NoSuchSheet"), XLInputError);
+        doc.close();
+    }
+}
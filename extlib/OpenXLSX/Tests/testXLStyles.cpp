@@ -0,0 +1,59 @@
+#include <OpenXLSX.hpp>
+#include <catch.hpp>
+
+using namespace OpenXLSX;
+
+TEST_CASE("XLStyles Tests", "[XLStyles]")
+{
+    SECTION("findOrCreate reuses identical fonts and cell formats")
+    {
+        XLDocument doc;
+        doc.create("./testXLStyles.xlsx", XLForceOverwrite);
+        XLStyles& styles = doc.styles();
+
+        const size_t fontCount   = styles.fonts().count();
+        const size_t formatCount = styles.cellFormats().count();
+
+        XLStyleIndex firstFormat = XLInvalidStyleIndex;
+        for (int i = 0; i < 100; ++i) {
+            const XLStyleIndex font   = styles.fonts().findOrCreate(styles.fonts()[0], [](XLFont& f) { f.setBold(true); });
+            const XLStyleIndex format = styles.cellFormats().findOrCreate(styles.cellFormats()[0],
+                                                                          [font](XLCellFormat& f) { f.setFontIndex(font); });
+            if (i == 0) firstFormat = format;
+            REQUIRE(format == firstFormat);
+        }
+
+        REQUIRE(styles.fonts().count() == fontCount + 1);
+        REQUIRE(styles.cellFormats().count() == formatCount + 1);
+        REQUIRE(styles.fonts()[styles.cellFormats()[firstFormat].fontIndex()].bold());
+        REQUIRE_FALSE(styles.fonts()[0].bold());    // the template itself is left untouched
+    }
+
+    SECTION("findOrCreate without modification returns the template index")
+    {
+        XLDocument doc;
+        doc.create("./testXLStyles.xlsx", XLForceOverwrite);
+        XLStyles& styles = doc.styles();
+
+        const size_t fillCount = styles.fills().count();
+        REQUIRE(styles.fills().findOrCreate(styles.fills()[0]) == 0);
+        REQUIRE(styles.borders().findOrCreate(styles.borders()[0]) == 0);
+        REQUIRE(styles.fills().count() == fillCount);
+    }
+
+    SECTION("Entries modified in place are not reused under their old form")
+    {
+        XLDocument doc;
+        doc.create("./testXLStyles.xlsx", XLForceOverwrite);
+        XLStyles& styles = doc.styles();
+
+        const XLStyleIndex italic = styles.fonts().findOrCreate(styles.fonts()[0], [](XLFont& f) { f.setItalic(true); });
+        styles.fonts()[italic].setFontSize(20);    // italic entry no longer matches its interned form
+
+        const XLStyleIndex again = styles.fonts().findOrCreate(styles.fonts()[0], [](XLFont& f) { f.setItalic(true); });
+        REQUIRE(again != italic);
+        REQUIRE(styles.fonts()[again].italic());
+        REQUIRE(styles.fonts()[again].fontSize() == styles.fonts()[0].fontSize());
+        REQUIRE(styles.fonts()[italic].fontSize() == 20);
+    }
+}
@@ -12,6 +12,8 @@
 #include <mutex>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <functional>
 
 namespace mcp {
 
@@ -22,6 +24,9 @@ enum class log_level {
     error
 };
 
+// Receives each message that passed the level check, without timestamp or level prefix
+using log_sink = std::function<void(log_level, const std::string&)>;
+
 class logger {
 public:
     static logger& instance() {
@@ -30,8 +35,19 @@ public:
     }
     
     void set_level(log_level level) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        level_ = level;
+        level_.store(level, std::memory_order_relaxed);
+    }
+
+    bool enabled(log_level level) const {
+        return level >= level_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Hand messages to sink instead of writing them to std::cerr
+     * @note Set it before any other thread logs, e.g. before starting a server
+     */
+    void set_sink(log_sink sink) {
+        sink_ = std::move(sink);
     }
     
     template<typename... Args>
@@ -70,56 +86,72 @@ private:
     
     template<typename... Args>
     void log(log_level level, Args&&... args) {
-        if (level < level_) {
+        if (!enabled(level)) {
             return;
         }
         
         std::stringstream ss;
-        
-        // Add timestamp
-        auto now = std::chrono::system_clock::now();
-        auto now_c = std::chrono::system_clock::to_time_t(now);
-        auto now_tm = std::localtime(&now_c);
-        
-        ss << std::put_time(now_tm, "%Y-%m-%d %H:%M:%S") << " ";
+        log_impl(ss, std::forward<Args>(args)...);
+        if (sink_) {
+            sink_(level, ss.str());
+            return;
+        }
+        write(level, ss.str());
+    }
+
+    void write(log_level level, const std::string& message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Add timestamp; std::localtime returns a shared buffer, so it is only used under the lock
+        auto now_c = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        std::cerr << std::put_time(std::localtime(&now_c), "%Y-%m-%d %H:%M:%S") << " ";
         
         // Add log level and color
         switch (level) {
             case log_level::debug:
-                ss << "\033[36m[DEBUG]\033[0m ";  // Cyan
+                std::cerr << "\033[36m[DEBUG]\033[0m ";  // Cyan
                 break;
             case log_level::info:
-                ss << "\033[32m[INFO]\033[0m ";   // Green
+                std::cerr << "\033[32m[INFO]\033[0m ";   // Green
                 break;
             case log_level::warning:
-                ss << "\033[33m[WARNING]\033[0m "; // Yellow
+                std::cerr << "\033[33m[WARNING]\033[0m "; // Yellow
                 break;
             case log_level::error:
-                ss << "\033[31m[ERROR]\033[0m ";   // Red
+                std::cerr << "\033[31m[ERROR]\033[0m ";   // Red
                 break;
         }
         
-        // Add log content
-        log_impl(ss, std::forward<Args>(args)...);
-        
-        // Output log
-        std::lock_guard<std::mutex> lock(mutex_);
-        std::cerr << ss.str() << std::endl;
+        // std::cerr is unbuffered, so no flush is needed
+        std::cerr << message << '\n';
     }
     
-    log_level level_;
+    std::atomic<log_level> level_;
+    log_sink sink_;
     std::mutex mutex_;
 };
 
-#define LOG_DEBUG(...) mcp::logger::instance().debug(__VA_ARGS__)
-#define LOG_INFO(...) mcp::logger::instance().info(__VA_ARGS__)
-#define LOG_WARNING(...) mcp::logger::instance().warning(__VA_ARGS__)
-#define LOG_ERROR(...) mcp::logger::instance().error(__VA_ARGS__)
+// The arguments are only evaluated if the level is enabled
+#define MCP_LOG_IF_ENABLED(level, method, ...) \
+    do { \
+        if (mcp::logger::instance().enabled(level)) { \
+            mcp::logger::instance().method(__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define LOG_DEBUG(...) MCP_LOG_IF_ENABLED(mcp::log_level::debug, debug, __VA_ARGS__)
+#define LOG_INFO(...) MCP_LOG_IF_ENABLED(mcp::log_level::info, info, __VA_ARGS__)
+#define LOG_WARNING(...) MCP_LOG_IF_ENABLED(mcp::log_level::warning, warning, __VA_ARGS__)
+#define LOG_ERROR(...) MCP_LOG_IF_ENABLED(mcp::log_level::error, error, __VA_ARGS__)
 
 inline void set_log_level(log_level level) {
     mcp::logger::instance().set_level(level);
 }
 
+inline void set_log_sink(log_sink sink) {
+    mcp::logger::instance().set_sink(std::move(sink));
+}
+
 } // namespace mcp
 
 #endif // MCP_LOGGER_H 
\ No newline at end of file
@@ -135,11 +135,11 @@ struct response {
     json error;
     
     // Create a success response
-    static response create_success(const json& req_id, const json& result_data = json::object()) {
+    static response create_success(const json& req_id, json result_data = json::object()) {
         response res;
         res.jsonrpc = "2.0";
         res.id = req_id;
-        res.result = result_data;
+        res.result = std::move(result_data);
         return res;
     }
     
@@ -166,7 +166,7 @@ struct response {
     }
     
     // Convert to JSON
-    json to_json() const {
+    json to_json() const & {
         json j = {
             {"jsonrpc", jsonrpc},
             {"id", id}
@@ -181,6 +181,22 @@ struct response {
         return j;
     }
 
+    // Convert to JSON, moving the result or error instead of copying it
+    json to_json() && {
+        json j = {
+            {"jsonrpc", jsonrpc},
+            {"id", id}
+        };
+        
+        if (is_error()) {
+            j["error"] = std::move(error);
+        } else {
+            j["result"] = std::move(result);
+        }
+        
+        return j;
+    }
+
     static response from_json(const json& j) {
         response res;
         res.jsonrpc = j["jsonrpc"].get<std::string>();
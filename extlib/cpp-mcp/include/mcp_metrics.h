@@ -0,0 +1,246 @@
+/**
+ * @file mcp_metrics.h
+ * @brief Latency histograms and counters exported in the Prometheus text format
+ *
+ * Recording a value is a few relaxed atomic additions and takes no lock. The work of reading the metrics (summing
+ * buckets, estimating quantiles, formatting) is only done when they are scraped.
+ */
+
+#ifndef MCP_METRICS_H
+#define MCP_METRICS_H
+
+#include "mcp_resource.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+
+namespace mcp {
+
+/**
+ * @class latency_histogram
+ * @brief Histogram of durations with log-linear buckets, in the style of HdrHistogram
+ *
+ * Durations are counted in microseconds. Below 8us every value has its own bucket; above, each power of two is
+ * split into 8 buckets, so a value is known to within 12.5% from 1us up to about 12 days. Longer durations are
+ * counted in the last bucket.
+ */
+class latency_histogram {
+public:
+    static constexpr int sub_bucket_bits = 3;
+    static constexpr size_t sub_bucket_count = size_t(1) << sub_bucket_bits;
+    static constexpr int max_exponent = 39; // Highest power of two with buckets of its own
+    static constexpr size_t bucket_count = (max_exponent - sub_bucket_bits + 2) * sub_bucket_count;
+
+    /**
+     * @brief Count one duration
+     * @param duration The duration
+     */
+    void record(std::chrono::nanoseconds duration) noexcept {
+        const int64_t ns = duration.count();
+        const uint64_t us = ns > 0 ? static_cast<uint64_t>(ns) / 1000 : 0;
+        counts_[bucket_index(us)].fetch_add(1, std::memory_order_relaxed);
+        sum_ns_.fetch_add(ns > 0 ? static_cast<uint64_t>(ns) : 0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief A consistent enough copy of the histogram, taken when it is read
+     */
+    struct snapshot {
+        std::array<uint64_t, bucket_count> counts{};
+        uint64_t count = 0;
+        double sum_seconds = 0;
+
+        /**
+         * @brief Estimate a quantile
+         * @param q The quantile, between 0 and 1
+         * @return The upper bound in seconds of the bucket the quantile falls in, or 0 if nothing was recorded
+         */
+        double quantile(double q) const;
+    };
+
+    /**
+     * @brief Read the histogram
+     * @return The counts recorded so far
+     */
+    snapshot read() const;
+
+    /**
+     * @brief Get the bucket a duration is counted in
+     * @param us The duration in microseconds
+     * @return The bucket index
+     */
+    static size_t bucket_index(uint64_t us) noexcept;
+
+    /**
+     * @brief Get the bound above the durations counted in a bucket
+     * @param index The bucket index
+     * @return The upper bound in microseconds (exclusive)
+     */
+    static uint64_t bucket_upper_bound(size_t index) noexcept;
+
+private:
+    std::array<std::atomic<uint64_t>, bucket_count> counts_{};
+    std::atomic<uint64_t> sum_ns_{0};
+};
+
+/**
+ * @class metric_counter
+ * @brief A monotonically increasing count
+ */
+class metric_counter {
+public:
+    void add(uint64_t value = 1) noexcept {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const noexcept {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * @class scoped_timer
+ * @brief Records the time from its construction to its destruction, or to stop()
+ */
+class scoped_timer {
+public:
+    explicit scoped_timer(latency_histogram& histogram)
+        : histogram_(&histogram), start_(std::chrono::steady_clock::now()) {
+    }
+
+    ~scoped_timer() {
+        stop();
+    }
+
+    scoped_timer(const scoped_timer&) = delete;
+    scoped_timer& operator=(const scoped_timer&) = delete;
+
+    /**
+     * @brief Record the time elapsed so far; later calls and the destructor do nothing
+     */
+    void stop() noexcept {
+        if (histogram_) {
+            histogram_->record(std::chrono::steady_clock::now() - start_);
+            histogram_ = nullptr;
+        }
+    }
+
+private:
+    latency_histogram* histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @class metrics
+ * @brief Registry of the process's metrics
+ *
+ * A metric is identified by its name and its labels. Looking one up takes a lock, so callers on hot paths look
+ * their metrics up once and keep the reference, which stays valid for the life of the process. Histograms are
+ * exported as Prometheus summaries (quantiles, sum and count).
+ */
+class metrics {
+public:
+    static metrics& instance();
+
+    /**
+     * @brief Get or create a latency histogram
+     * @param name The metric name, in seconds by convention (e.g. "mcp_tool_call_seconds")
+     * @param labels The labels, as built by labels()
+     * @return The histogram
+     */
+    latency_histogram& histogram(const std::string& name, const std::string& labels = "");
+
+    /**
+     * @brief Get or create a counter
+     * @param name The metric name, ending in "_total" by convention
+     * @param labels The labels, as built by labels()
+     * @return The counter
+     */
+    metric_counter& counter(const std::string& name, const std::string& labels = "");
+
+    /**
+     * @brief Register a gauge whose value is computed when the metrics are read
+     * @param name The metric name
+     * @param labels The labels, as built by labels()
+     * @param value Returns the current value. It must not look up or register metrics.
+     */
+    void gauge(const std::string& name, const std::string& labels, std::function<double()> value);
+
+    /**
+     * @brief Set the help text of a metric
+     * @param name The metric name
+     * @param help The help text
+     */
+    void describe(const std::string& name, const std::string& help);
+
+    /**
+     * @brief Render all metrics in the Prometheus text exposition format (version 0.0.4)
+     * @return The text
+     */
+    std::string render_prometheus() const;
+
+    /**
+     * @brief Build a label set
+     * @param labels Label names and values; values are escaped
+     * @return The labels in the form name="value",name="value"
+     */
+    static std::string labels(std::initializer_list<std::pair<std::string, std::string>> labels);
+
+private:
+    metrics() = default;
+    metrics(const metrics&) = delete;
+    metrics& operator=(const metrics&) = delete;
+
+    struct family {
+        std::string help;
+        std::map<std::string, std::unique_ptr<latency_histogram>> histograms;
+        std::map<std::string, std::unique_ptr<metric_counter>> counters;
+        std::map<std::string, std::function<double()>> gauges;
+    };
+
+    template<typename T>
+    T& find_or_create(const std::string& name, const std::string& labels,
+                      std::map<std::string, std::unique_ptr<T>> family::*member);
+
+    std::map<std::string, family> families_;
+    mutable std::shared_mutex mutex_;
+};
+
+/**
+ * @class metrics_resource
+ * @brief Resource holding the current metrics in the Prometheus text format
+ *
+ * The text is rendered each time the resource is read.
+ */
+class metrics_resource : public resource {
+public:
+    /**
+     * @brief Constructor
+     * @param uri The URI of the resource
+     */
+    explicit metrics_resource(const std::string& uri = "metrics://prometheus");
+
+    json get_metadata() const override;
+    json read() const override;
+    bool is_modified() const override;
+    std::string get_uri() const override;
+
+private:
+    std::string uri_;
+};
+
+} // namespace mcp
+
+#endif // MCP_METRICS_H
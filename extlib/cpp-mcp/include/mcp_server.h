@@ -14,6 +14,8 @@
 #include "mcp_tool.h"
 #include "mcp_thread_pool.h"
 #include "mcp_logger.h"
+#include "mcp_metrics.h"
+#include "mcp_trace.h"
 
 // Include the HTTP library
 #include "httplib.h"
@@ -29,6 +31,8 @@
 #include <condition_variable>
 #include <future>
 #include <atomic>
+#include <deque>
+#include <queue>
 
 
 namespace mcp {
@@ -41,14 +45,13 @@ using session_cleanup_handler = std::function<void(const std::string&)>;
 
 class event_dispatcher {
 public:
-    event_dispatcher() {
-        message_.reserve(128); // Pre-allocate space for messages
-    }
+    event_dispatcher() = default;
     
     ~event_dispatcher() {
         close();
     }
 
+    // Wait for queued events and write all of them to the sink
     bool wait_event(httplib::DataSink* sink, const std::chrono::milliseconds& timeout = std::chrono::milliseconds(10000)) {
         if (!sink || closed_.load(std::memory_order_acquire)) {
             return false;
@@ -58,14 +61,8 @@ public:
         {
             std::unique_lock<std::mutex> lk(m_);
             
-            if (closed_.load(std::memory_order_acquire)) {
-                return false;
-            }
-            
-            int id = id_.load(std::memory_order_relaxed);
-            
             bool result = cv_.wait_for(lk, timeout, [&] { 
-                return cid_.load(std::memory_order_relaxed) == id || closed_.load(std::memory_order_acquire); 
+                return !messages_.empty() || closed_.load(std::memory_order_acquire); 
             });
             
             if (closed_.load(std::memory_order_acquire)) {
@@ -76,20 +73,26 @@ public:
                 return false;
             }
             
-            // Only copy the message if there is one
-            if (!message_.empty()) {
-                message_copy.swap(message_);
-            } else {
-                return true; // No message but condition satisfied
+            // Events sent while the previous write was in progress are written together
+            message_copy.swap(messages_.front());
+            messages_.pop_front();
+            while (!messages_.empty()) {
+                message_copy += messages_.front();
+                messages_.pop_front();
             }
         }
         
         try {
             if (!message_copy.empty()) {
+                static latency_histogram& write_time = metrics::instance().histogram("mcp_sse_write_seconds");
+                static metric_counter& sent_bytes = metrics::instance().counter("mcp_sent_bytes_total");
+                MCP_TRACE_SCOPE("mcp", "event_dispatcher::write");
+                scoped_timer timer(write_time);
                 if (!sink->write(message_copy.data(), message_copy.size())) {
                     close();
                     return false;
                 }
+                sent_bytes.add(message_copy.size());
             }
             return true;
         } catch (...) {
@@ -98,7 +101,9 @@ public:
         }
     }
 
-    bool send_event(const std::string& message) {
+    // Queue an event for the session's SSE stream
+    bool send_event(std::string message) {
+        MCP_TRACE_SCOPE("mcp", "event_dispatcher::send_event");
         if (closed_.load(std::memory_order_acquire) || message.empty()) {
             return false;
         }
@@ -110,13 +115,7 @@ public:
                 return false;
             }
             
-            // Efficiently set the message and allocate space as needed
-            if (message.size() > message_.capacity()) {
-                message_.reserve(message.size() + 64); // Pre-allocate extra space to avoid frequent reallocations
-            }
-            message_ = message;
-            
-            cid_.store(id_.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+            messages_.push_back(std::move(message));
             cv_.notify_one(); // Notify waiting threads
             return true;
         } catch (...) {
@@ -131,6 +130,7 @@ public:
         }
         
         try {
+            std::lock_guard<std::mutex> lk(m_);
             cv_.notify_all();
         } catch (...) {
             // Ignore exceptions
@@ -156,9 +156,7 @@ public:
 private:
     mutable std::mutex m_;
     std::condition_variable cv_;
-    std::atomic<int> id_{0};
-    std::atomic<int> cid_{-1};
-    std::string message_;
+    std::deque<std::string> messages_;
     std::atomic<bool> closed_{false};
     std::chrono::steady_clock::time_point last_activity_{std::chrono::steady_clock::now()};
 };
@@ -252,10 +250,20 @@ public:
      */
     void register_tool(const tool& tool, tool_handler handler);
 
+    /**
+     * @brief Hand one argument of a tool to its handler unparsed
+     * @param tool_name The name of the tool
+     * @param argument The name of the argument
+     * @note When a tools/call request carries the argument inline, its value is neither parsed nor validated by the
+     *       server. The handler receives it as a binary JSON value holding the argument's JSON text, which it can
+     *       decode with json::sax_parse. Arguments sent as a JSON string are parsed as usual.
+     */
+    void set_raw_argument(const std::string& tool_name, const std::string& argument);
+
     /**
      * @brief Register a session cleanup handler
      * @param key Tool or resource name to be cleaned up
-     * @param handler The function to call when the session is closed
+     * @param handler The function to call with the session ID when a session is closed
      */
     void register_session_cleanup(const std::string& key, session_cleanup_handler handler);
     
@@ -289,6 +297,22 @@ public:
      */
     bool set_mount_point(const std::string& mount_point, const std::string& dir, httplib::Headers headers = httplib::Headers());
 
+    /**
+     * @brief Serve the metrics over HTTP
+     * @param path The path of the endpoint (e.g. "/metrics"), or empty to serve no endpoint (the default)
+     * @note Must be called before start(). The endpoint serves mcp::metrics in the Prometheus text format; the
+     *       metrics are recorded whether or not they are served.
+     */
+    void set_metrics_endpoint(const std::string& path);
+
+    /**
+     * @brief Serve the recorded trace spans over HTTP
+     * @param path The path of the endpoint (e.g. "/trace"), or empty to serve no endpoint (the default)
+     * @note Must be called before start(). The endpoint serves mcp::trace_buffer in the Chrome trace-event format.
+     *       Spans are only recorded when the library is built with MCP_ENABLE_TRACING.
+     */
+    void set_trace_endpoint(const std::string& path);
+
 private:
     std::string host_;
     int port_;
@@ -302,12 +326,6 @@ private:
     // Server thread (for non-blocking mode)
     std::unique_ptr<std::thread> server_thread_;
 
-    // SSE thread
-    std::map<std::string, std::unique_ptr<std::thread>> sse_threads_;
-
-    // Event dispatcher for server-sent events
-    event_dispatcher sse_dispatcher_;
-    
     // Session-specific event dispatchers
     std::map<std::string, std::shared_ptr<event_dispatcher>> session_dispatchers_;
 
@@ -326,6 +344,29 @@ private:
     
     // Tools map (name -> handler)
     std::map<std::string, std::pair<tool, tool_handler>> tools_;
+
+    // Arguments passed to tools as unparsed text (tool name -> argument name)
+    std::map<std::string, std::string> raw_arguments_;
+
+    // Metrics of a tool, looked up when the tool is registered
+    struct tool_metrics {
+        latency_histogram* duration;
+        metric_counter* errors;
+        metric_counter* received_bytes;
+        metric_counter* sent_bytes;
+    };
+    std::map<std::string, tool_metrics> tool_metrics_;
+
+    // Server-wide metrics
+    latency_histogram& queue_wait_time_;
+    latency_histogram& response_encode_time_;
+    metric_counter& received_bytes_;
+
+    // Path of the metrics endpoint, empty if none is served
+    std::string metrics_endpoint_;
+
+    // Path of the trace endpoint, empty if none is served
+    std::string trace_endpoint_;
     
     // Authentication handler
     auth_handler auth_handler_;
@@ -334,7 +375,7 @@ private:
     mutable std::mutex mutex_;
     
     // Running flag
-    bool running_ = false;
+    std::atomic<bool> running_{false};
     
     // Thread pool for async method handlers
     thread_pool thread_pool_;
@@ -345,8 +386,12 @@ private:
     // Handle SSE requests
     void handle_sse(const httplib::Request& req, httplib::Response& res);
     
-    // Handle incoming JSON-RPC requests
-    void handle_jsonrpc(const httplib::Request& req, httplib::Response& res);
+    // Handle incoming JSON-RPC requests. The body is read by the route rather than into req.body, so that a raw
+    // argument can be cut out of it in place and handed on without a copy.
+    void handle_jsonrpc(const httplib::Request& req, std::vector<uint8_t> body, httplib::Response& res);
+
+    // Metrics of a registered tool, or nullptr
+    tool_metrics* find_tool_metrics(const json& params);
 
     // Send a JSON-RPC message to a client
     void send_jsonrpc(const std::string& session_id, const json& message);
@@ -391,7 +436,26 @@ private:
 
     // Session management and maintenance
     void check_inactive_sessions();
-    std::unique_ptr<std::thread> maintenance_thread_;
+
+    // Heartbeat due for an SSE session
+    struct session_timer {
+        std::chrono::steady_clock::time_point due;
+        std::string session_id;
+        int heartbeat_count;
+
+        bool operator>(const session_timer& other) const {
+            return due > other.due;
+        }
+    };
+
+    // One thread sends the heartbeats of all SSE sessions and closes inactive sessions
+    void run_session_loop();
+    void schedule_heartbeat(const std::string& session_id, int heartbeat_count);
+    void send_heartbeat(const session_timer& timer);
+    std::unique_ptr<std::thread> session_loop_thread_;
+    std::priority_queue<session_timer, std::vector<session_timer>, std::greater<session_timer>> session_timers_;
+    std::mutex session_loop_mutex_;
+    std::condition_variable session_loop_cv_;
 
     // Session cleanup handler
     std::map<std::string, session_cleanup_handler> session_cleanup_handler_;
@@ -1,6 +1,10 @@
 /**
  * @file mcp_thread_pool.h
  * @brief Simple thread pool implementation
+ *
+ * Tasks submitted from one of the pool's own workers run inline on that worker. A worker that submits a task and
+ * waits for its future would otherwise block while the task sits in the queue behind other such workers, which
+ * starves (or, with every worker waiting, deadlocks) the pool under concurrent load.
  */
 
 #ifndef MCP_THREAD_POOL_H
@@ -15,6 +19,8 @@
 #include <future>
 #include <atomic>
 #include <type_traits>
+#include <algorithm>
+#include <stdexcept>
 
 namespace mcp {
 
@@ -25,8 +31,11 @@ public:
      * @param num_threads Number of threads in the thread pool
      */
     explicit thread_pool(size_t num_threads = std::thread::hardware_concurrency()) : stop_(false) {
+        // hardware_concurrency() may return 0 when it cannot be determined
+        num_threads = (std::max)(num_threads, size_t(1));
         for (size_t i = 0; i < num_threads; ++i) {
             workers_.emplace_back([this] {
+                current_pool() = this;
                 while (true) {
                     std::function<void()> task;
                     
@@ -68,11 +77,18 @@ public:
         }
     }
     
+    /**
+     * @brief Check whether the calling thread is one of this pool's workers
+     */
+    bool is_worker_thread() const {
+        return current_pool() == this;
+    }
+
     /**
      * @brief Submit task to thread pool
      * @param f Task function
      * @param args Task parameters
-     * @return Task future
+     * @return Task future. When called from a worker of this pool, the task has already run and the future is ready.
      */
     template<class F, class... Args>
     auto enqueue(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type> {
@@ -84,6 +100,11 @@ public:
         
         std::future<return_type> result = task->get_future();
         
+        if (is_worker_thread()) {
+            (*task)();
+            return result;
+        }
+        
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
             
@@ -99,6 +120,12 @@ public:
     }
     
 private:
+    // Pool whose worker is the calling thread, if any
+    static const thread_pool*& current_pool() {
+        static thread_local const thread_pool* pool = nullptr;
+        return pool;
+    }
+    
     // Worker threads
     std::vector<std::thread> workers_;
     
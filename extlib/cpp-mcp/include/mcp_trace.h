@@ -0,0 +1,125 @@
+/**
+ * @file mcp_trace.h
+ * @brief Trace spans kept in a ring buffer and exported in the Chrome trace-event format
+ *
+ * Spans are recorded with MCP_TRACE_SCOPE, which compiles to nothing unless MCP_ENABLE_TRACING is defined. The
+ * exported JSON can be opened in chrome://tracing or https://ui.perfetto.dev.
+ */
+
+#ifndef MCP_TRACE_H
+#define MCP_TRACE_H
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mcp {
+
+/**
+ * @class trace_buffer
+ * @brief Ring buffer of the most recent completed spans
+ *
+ * When the buffer is full, each new span replaces the oldest one.
+ */
+class trace_buffer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    static trace_buffer& instance();
+
+    /**
+     * @brief Record a completed span
+     * @param category The category of the span, a string literal (e.g. "mcp")
+     * @param name The name of the span, a string literal
+     * @param detail What the span worked on (e.g. a tool name); may be empty
+     * @param start The time the span started
+     * @param end The time the span ended
+     */
+    void record(const char* category, const char* name, std::string detail, clock::time_point start, clock::time_point end);
+
+    /**
+     * @brief Export the recorded spans, oldest first
+     * @return A Chrome trace-event JSON object with one complete ("X") event per span
+     */
+    std::string to_chrome_json() const;
+
+    /**
+     * @brief Set how many spans are kept (65536 by default); drops the recorded spans
+     * @param capacity The number of spans
+     */
+    void set_capacity(size_t capacity);
+
+    /**
+     * @brief Drop the recorded spans
+     */
+    void clear();
+
+private:
+    trace_buffer();
+    trace_buffer(const trace_buffer&) = delete;
+    trace_buffer& operator=(const trace_buffer&) = delete;
+
+    struct event {
+        const char* category;
+        const char* name;
+        std::string detail;
+        clock::time_point start;
+        clock::time_point end;
+        uint32_t thread;
+    };
+
+    // Small sequential id of the calling thread, which reads better in trace viewers than a hashed thread id
+    static uint32_t current_thread();
+
+    std::vector<event> events_;
+    size_t capacity_ = 65536;
+    size_t next_ = 0;              // Slot the next span is written to, once events_ is full
+    clock::time_point epoch_;      // Timestamps are exported relative to this
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @class trace_scope
+ * @brief Records the time from its construction to its destruction as a span. Used through MCP_TRACE_SCOPE.
+ */
+class trace_scope {
+public:
+    trace_scope(const char* category, const char* name, std::string detail = std::string())
+        : category_(category), name_(name), detail_(std::move(detail)), start_(trace_buffer::clock::now()) {
+    }
+
+    ~trace_scope() {
+        trace_buffer::instance().record(category_, name_, std::move(detail_), start_, trace_buffer::clock::now());
+    }
+
+    trace_scope(const trace_scope&) = delete;
+    trace_scope& operator=(const trace_scope&) = delete;
+
+private:
+    const char* category_;
+    const char* name_;
+    std::string detail_;
+    trace_buffer::clock::time_point start_;
+};
+
+} // namespace mcp
+
+#ifdef MCP_ENABLE_TRACING
+#define MCP_TRACE_CONCAT_(a, b) a##b
+#define MCP_TRACE_CONCAT(a, b) MCP_TRACE_CONCAT_(a, b)
+// Records the rest of the enclosing scope as a span; the arguments are not evaluated when tracing is disabled
+#define MCP_TRACE_SCOPE(category, name) ::mcp::trace_scope MCP_TRACE_CONCAT(mcp_trace_scope_, __LINE__)(category, name)
+#define MCP_TRACE_SCOPE_DETAIL(category, name, detail) \
+    ::mcp::trace_scope MCP_TRACE_CONCAT(mcp_trace_scope_, __LINE__)(category, name, detail)
+// Records a span whose start and end were measured already
+#define MCP_TRACE_SPAN(category, name, start, end) ::mcp::trace_buffer::instance().record(category, name, std::string(), start, end)
+#else
+#define MCP_TRACE_SCOPE(category, name) ((void)0)
+#define MCP_TRACE_SCOPE_DETAIL(category, name, detail) ((void)0)
+#define MCP_TRACE_SPAN(category, name, start, end) ((void)0)
+#endif
+
+#endif // MCP_TRACE_H
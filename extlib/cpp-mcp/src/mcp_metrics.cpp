@@ -0,0 +1,239 @@
+/**
+ * @file mcp_metrics.cpp
+ * @brief Implementation of the metrics registry
+ */
+
+#include "mcp_metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+
+namespace mcp {
+
+namespace {
+
+int floor_log2(uint64_t value) {
+    int result = 0;
+    for (int bits = 32; bits > 0; bits /= 2) {
+        if (value >= (uint64_t(1) << bits)) {
+            value >>= bits;
+            result += bits;
+        }
+    }
+    return result;
+}
+
+void append_number(std::string& out, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    out.append(buffer, length > 0 ? static_cast<size_t>(length) : 0);
+}
+
+// name{labels,extra} value
+void append_sample(std::string& out, const std::string& name, const std::string& labels, const std::string& extra, double value) {
+    out += name;
+    if (!labels.empty() || !extra.empty()) {
+        out += '{';
+        out += labels;
+        if (!labels.empty() && !extra.empty()) {
+            out += ',';
+        }
+        out += extra;
+        out += '}';
+    }
+    out += ' ';
+    append_number(out, value);
+    out += '\n';
+}
+
+void append_escaped(std::string& out, const std::string& text, bool quotes) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '"' && quotes) {
+            out += "\\\"";
+        } else {
+            out += c;
+        }
+    }
+}
+
+const double summary_quantiles[] = {0.5, 0.9, 0.99, 0.999};
+
+} // namespace
+
+size_t latency_histogram::bucket_index(uint64_t us) noexcept {
+    if (us < sub_bucket_count) {
+        return static_cast<size_t>(us);
+    }
+    const int exponent = floor_log2(us);
+    if (exponent > max_exponent) {
+        return bucket_count - 1;
+    }
+    const int shift = exponent - sub_bucket_bits;
+    return (shift + 1) * sub_bucket_count + static_cast<size_t>((us >> shift) - sub_bucket_count);
+}
+
+uint64_t latency_histogram::bucket_upper_bound(size_t index) noexcept {
+    if (index < sub_bucket_count) {
+        return index + 1;
+    }
+    const size_t shift = index / sub_bucket_count - 1;
+    const uint64_t sub_bucket = index % sub_bucket_count + sub_bucket_count;
+    return (sub_bucket + 1) << shift;
+}
+
+latency_histogram::snapshot latency_histogram::read() const {
+    snapshot result;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        result.counts[i] = counts_[i].load(std::memory_order_relaxed);
+        result.count += result.counts[i];
+    }
+    result.sum_seconds = static_cast<double>(sum_ns_.load(std::memory_order_relaxed)) / 1e9;
+    return result;
+}
+
+double latency_histogram::snapshot::quantile(double q) const {
+    if (count == 0) {
+        return 0;
+    }
+    const uint64_t rank = (std::max)(uint64_t(1), static_cast<uint64_t>(std::ceil(q * static_cast<double>(count))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucket_count; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            return static_cast<double>(bucket_upper_bound(i)) / 1e6;
+        }
+    }
+    return static_cast<double>(bucket_upper_bound(bucket_count - 1)) / 1e6;
+}
+
+metrics& metrics::instance() {
+    static metrics instance;
+    return instance;
+}
+
+template<typename T>
+T& metrics::find_or_create(const std::string& name, const std::string& labels,
+                           std::map<std::string, std::unique_ptr<T>> family::*member) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto family_it = families_.find(name);
+        if (family_it != families_.end()) {
+            auto& values = family_it->second.*member;
+            auto it = values.find(labels);
+            if (it != values.end()) {
+                return *it->second;
+            }
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto& slot = (families_[name].*member)[labels];
+    if (!slot) {
+        slot = std::make_unique<T>();
+    }
+    return *slot;
+}
+
+latency_histogram& metrics::histogram(const std::string& name, const std::string& labels) {
+    return find_or_create(name, labels, &family::histograms);
+}
+
+metric_counter& metrics::counter(const std::string& name, const std::string& labels) {
+    return find_or_create(name, labels, &family::counters);
+}
+
+void metrics::gauge(const std::string& name, const std::string& labels, std::function<double()> value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    families_[name].gauges[labels] = std::move(value);
+}
+
+void metrics::describe(const std::string& name, const std::string& help) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    families_[name].help = help;
+}
+
+std::string metrics::render_prometheus() const {
+    std::string out;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& [name, family] : families_) {
+        const char* type = !family.histograms.empty() ? "summary" : !family.counters.empty() ? "counter" :
+                           !family.gauges.empty() ? "gauge" : nullptr;
+        if (!type) {
+            continue;
+        }
+        if (!family.help.empty()) {
+            out += "# HELP " + name + ' ';
+            append_escaped(out, family.help, false);
+            out += '\n';
+        }
+        out += "# TYPE " + name + ' ' + type + '\n';
+
+        for (const auto& [labels, histogram] : family.histograms) {
+            const latency_histogram::snapshot snapshot = histogram->read();
+            for (double q : summary_quantiles) {
+                std::string quantile = "quantile=\"";
+                append_number(quantile, q);
+                quantile += '"';
+                append_sample(out, name, labels, quantile, snapshot.quantile(q));
+            }
+            append_sample(out, name + "_sum", labels, "", snapshot.sum_seconds);
+            append_sample(out, name + "_count", labels, "", static_cast<double>(snapshot.count));
+        }
+        for (const auto& [labels, counter] : family.counters) {
+            append_sample(out, name, labels, "", static_cast<double>(counter->value()));
+        }
+        for (const auto& [labels, value] : family.gauges) {
+            append_sample(out, name, labels, "", value());
+        }
+    }
+    return out;
+}
+
+std::string metrics::labels(std::initializer_list<std::pair<std::string, std::string>> labels) {
+    std::string result;
+    for (const auto& [name, value] : labels) {
+        if (!result.empty()) {
+            result += ',';
+        }
+        result += name + "=\"";
+        append_escaped(result, value, true);
+        result += '"';
+    }
+    return result;
+}
+
+metrics_resource::metrics_resource(const std::string& uri) : uri_(uri) {
+}
+
+json metrics_resource::get_metadata() const {
+    return {
+        {"uri", uri_},
+        {"name", "metrics"},
+        {"mimeType", "text/plain"},
+        {"description", "Server metrics in the Prometheus text format"}
+    };
+}
+
+json metrics_resource::read() const {
+    return {
+        {"uri", uri_},
+        {"mimeType", "text/plain"},
+        {"text", metrics::instance().render_prometheus()}
+    };
+}
+
+bool metrics_resource::is_modified() const {
+    return true;
+}
+
+std::string metrics_resource::get_uri() const {
+    return uri_;
+}
+
+} // namespace mcp
@@ -8,11 +8,139 @@
 
 #include "mcp_server.h"
 
+#include <string_view>
+
 namespace mcp {
 
+namespace {
+
+// A minimal walk over JSON text, used to find where a member's value is without parsing it. Positions are bounds
+// checked, but the text is not validated: json::parse does that afterwards.
+
+constexpr size_t npos = std::string_view::npos;
+
+bool is_json_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+size_t skip_whitespace(std::string_view text, size_t pos) {
+    while (pos < text.size() && is_json_whitespace(text[pos])) {
+        ++pos;
+    }
+    return pos;
+}
+
+// Returns the position after the string starting at pos, or npos if it is not terminated
+size_t skip_string(std::string_view text, size_t pos) {
+    for (++pos; pos < text.size(); ++pos) {
+        if (text[pos] == '\\') {
+            ++pos;
+        } else if (text[pos] == '"') {
+            return pos + 1;
+        }
+    }
+    return npos;
+}
+
+// Returns the position after the value starting at pos, or npos if it is not terminated
+size_t skip_value(std::string_view text, size_t pos) {
+    if (pos >= text.size()) {
+        return npos;
+    }
+    if (text[pos] == '"') {
+        return skip_string(text, pos);
+    }
+    if (text[pos] == '{' || text[pos] == '[') {
+        size_t depth = 0;
+        while (pos < text.size()) {
+            char c = text[pos];
+            if (c == '"') {
+                pos = skip_string(text, pos);
+                if (pos == npos) {
+                    return npos;
+                }
+                continue;
+            }
+            if (c == '{' || c == '[') {
+                ++depth;
+            } else if ((c == '}' || c == ']') && --depth == 0) {
+                return pos + 1;
+            }
+            ++pos;
+        }
+        return npos;
+    }
+    while (pos < text.size() && text[pos] != ',' && text[pos] != '}' && text[pos] != ']' && !is_json_whitespace(text[pos])) {
+        ++pos;
+    }
+    return pos;
+}
+
+// Finds the text of the value of member key in the object held by text. Keys are compared as written, so a key
+// spelled with escapes is not found. As in json::parse, the last of duplicate keys wins.
+bool find_member(std::string_view text, std::string_view key, std::string_view& value) {
+    size_t pos = skip_whitespace(text, 0);
+    if (pos >= text.size() || text[pos] != '{') {
+        return false;
+    }
+    bool found = false;
+    pos = skip_whitespace(text, pos + 1);
+    while (pos < text.size() && text[pos] == '"') {
+        size_t key_end = skip_string(text, pos);
+        if (key_end == npos) {
+            return false;
+        }
+        std::string_view name = text.substr(pos + 1, key_end - pos - 2);
+        pos = skip_whitespace(text, key_end);
+        if (pos >= text.size() || text[pos] != ':') {
+            return false;
+        }
+        pos = skip_whitespace(text, pos + 1);
+        size_t value_end = skip_value(text, pos);
+        if (value_end == npos) {
+            return false;
+        }
+        if (name == key) {
+            value = text.substr(pos, value_end - pos);
+            found = true;
+        }
+        pos = skip_whitespace(text, value_end);
+        if (pos >= text.size() || text[pos] != ',') {
+            break;
+        }
+        pos = skip_whitespace(text, pos + 1);
+    }
+    return found;
+}
+
+// The unquoted text of a JSON string without escapes; false for any other value
+bool plain_string(std::string_view value, std::string_view& text) {
+    if (value.size() < 2 || value.front() != '"' || value.back() != '"' || value.find('\\') != npos) {
+        return false;
+    }
+    text = value.substr(1, value.size() - 2);
+    return true;
+}
+
+} // namespace
+
 server::server(const std::string& host, int port, const std::string& name, const std::string& version, const std::string& sse_endpoint, const std::string& msg_endpoint)
-    : host_(host), port_(port), name_(name), version_(version), sse_endpoint_(sse_endpoint), msg_endpoint_(msg_endpoint) {
+    : host_(host), port_(port), name_(name), version_(version), sse_endpoint_(sse_endpoint), msg_endpoint_(msg_endpoint),
+      queue_wait_time_(metrics::instance().histogram("mcp_queue_wait_seconds")),
+      response_encode_time_(metrics::instance().histogram("mcp_response_encode_seconds")),
+      received_bytes_(metrics::instance().counter("mcp_received_bytes_total")) {
     http_server_ = std::make_unique<httplib::Server>();
+
+    metrics& registry = metrics::instance();
+    registry.describe("mcp_tool_call_seconds", "Time spent in tool handlers");
+    registry.describe("mcp_tool_errors_total", "Tool calls that failed");
+    registry.describe("mcp_tool_received_bytes_total", "Size of the tools/call requests of a tool");
+    registry.describe("mcp_tool_sent_bytes_total", "Size of the responses to tools/call requests of a tool");
+    registry.describe("mcp_queue_wait_seconds", "Time requests waited in the thread pool queue");
+    registry.describe("mcp_response_encode_seconds", "Time spent serializing responses");
+    registry.describe("mcp_received_bytes_total", "Size of all JSON-RPC requests");
+    registry.describe("mcp_sent_bytes_total", "Bytes written to SSE streams, including heartbeats");
+    registry.describe("mcp_sse_write_seconds", "Time spent writing to SSE streams");
 }
 
 server::~server() {
@@ -35,8 +163,16 @@ bool server::start(bool blocking) {
     });
     
     // Setup JSON-RPC endpoint
-    http_server_->Post(msg_endpoint_.c_str(), [this](const httplib::Request& req, httplib::Response& res) {
-        this->handle_jsonrpc(req, res);
+    http_server_->Post(msg_endpoint_.c_str(), [this](const httplib::Request& req, httplib::Response& res,
+                                                     const httplib::ContentReader& content_reader) {
+        std::vector<uint8_t> body;
+        // Content-Length is only a hint, so a bogus value can not make the server allocate a huge buffer up front
+        body.reserve(static_cast<size_t>((std::min)(req.get_header_value_u64("Content-Length"), uint64_t(64) << 20)));
+        content_reader([&body](const char* data, size_t length) {
+            body.insert(body.end(), data, data + length);
+            return true;
+        });
+        this->handle_jsonrpc(req, std::move(body), res);
         LOG_INFO(req.remote_addr, ":", req.remote_port, " - \"POST ", req.path, " HTTP/1.1\" ", res.status);
     });
 
@@ -45,33 +181,34 @@ bool server::start(bool blocking) {
         this->handle_sse(req, res);
         LOG_INFO(req.remote_addr, ":", req.remote_port, " - \"GET ", req.path, " HTTP/1.1\" ", res.status);
     });
-    
-    // Start resource check thread (only start in non-blocking mode)
-    if (!blocking) {
-        maintenance_thread_ = std::make_unique<std::thread>([this]() {
-            while (running_) {
-                // Check inactive sessions every 60 seconds
-                std::this_thread::sleep_for(std::chrono::seconds(60));
-                if (running_) {
-                    try {
-                        check_inactive_sessions();
-                    } catch (const std::exception& e) {
-                        LOG_ERROR("Exception in maintenance thread: ", e.what());
-                    } catch (...) {
-                        LOG_ERROR("Unknown exception in maintenance thread");
-                    }
-                }
-            }
+
+    // Setup metrics endpoint
+    if (!metrics_endpoint_.empty()) {
+        http_server_->Get(metrics_endpoint_.c_str(), [](const httplib::Request&, httplib::Response& res) {
+            res.set_content(metrics::instance().render_prometheus(), "text/plain; version=0.0.4");
         });
     }
+
+    // Setup trace endpoint
+    if (!trace_endpoint_.empty()) {
+        http_server_->Get(trace_endpoint_.c_str(), [](const httplib::Request&, httplib::Response& res) {
+            res.set_content(trace_buffer::instance().to_chrome_json(), "application/json");
+        });
+    }
+    
+    running_ = true;
+    
+    // Start the session loop (heartbeats and inactive session cleanup)
+    session_loop_thread_ = std::make_unique<std::thread>([this]() {
+        run_session_loop();
+    });
     
     // Start server
     if (blocking) {
-        running_ = true;
         LOG_INFO("Starting server in blocking mode");
         if (!http_server_->listen(host_.c_str(), port_)) {
-            running_ = false;
             LOG_ERROR("Failed to start server on ", host_, ":", port_);
+            stop();
             return false;
         }
         return true;
@@ -81,138 +218,61 @@ bool server::start(bool blocking) {
             LOG_INFO("Starting server in separate thread");
             if (!http_server_->listen(host_.c_str(), port_)) {
                 LOG_ERROR("Failed to start server on ", host_, ":", port_);
-                running_ = false;
+                {
+                    std::lock_guard<std::mutex> lock(session_loop_mutex_);
+                    running_ = false;
+                }
+                session_loop_cv_.notify_all();
                 return;
             }
         });
-        running_ = true;
         return true;
     }
 }
 
 void server::stop() {
-    if (!running_) {
+    if (!running_.exchange(false)) {
+        // The server thread may have failed to listen and cleared the flag, leaving threads to join
+        if (session_loop_thread_ && session_loop_thread_->joinable()) {
+            session_loop_thread_->join();
+        }
+        if (server_thread_ && server_thread_->joinable()) {
+            server_thread_->join();
+        }
         return;
     }
     
     LOG_INFO("Stopping MCP server on ", host_, ":", port_);
-    running_ = false;
     
-    // Close maintenance thread
-    if (maintenance_thread_ && maintenance_thread_->joinable()) {
-        try {
-            maintenance_thread_->join();
-        } catch (...) {
-            maintenance_thread_->detach();
-        }
+    // Stop the session loop. Taking its mutex ensures the loop either sees running_ cleared or is waiting.
+    {
+        std::lock_guard<std::mutex> lock(session_loop_mutex_);
+    }
+    session_loop_cv_.notify_all();
+    if (session_loop_thread_ && session_loop_thread_->joinable()) {
+        session_loop_thread_->join();
     }
     
-    // Copy all dispatchers and threads to avoid holding the lock for too long
-    std::vector<std::shared_ptr<event_dispatcher>> dispatchers_to_close;
-    std::vector<std::unique_ptr<std::thread>> threads_to_join;
-    
+    // Close all sessions, which ends their SSE streams
+    std::vector<std::string> session_ids;
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        
-        // Copy all dispatchers
-        dispatchers_to_close.reserve(session_dispatchers_.size());
-        for (const auto& [_, dispatcher] : session_dispatchers_) {
-            dispatchers_to_close.push_back(dispatcher);
-        }
-        
-        // Copy all threads
-        threads_to_join.reserve(sse_threads_.size());
-        for (auto& [_, thread] : sse_threads_) {
-            if (thread && thread->joinable()) {
-                threads_to_join.push_back(std::move(thread));
-            }
+        session_ids.reserve(session_dispatchers_.size());
+        for (const auto& [session_id, _] : session_dispatchers_) {
+            session_ids.push_back(session_id);
         }
-        
-        // Clear the maps
-        session_dispatchers_.clear();
-        sse_threads_.clear();
-        session_initialized_.clear();
     }
-    
-    // Close all sessions
-    for (const auto& [session_id, _] : session_dispatchers_) {
+    for (const auto& session_id : session_ids) {
         close_session(session_id);
     }
     
-    // Give threads some time to handle close events
-    std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    
-    // Wait for threads to finish outside the lock (with timeout limit)
-    const auto timeout_point = std::chrono::steady_clock::now() + std::chrono::seconds(2);
-    
-    for (auto& thread : threads_to_join) {
-        if (!thread || !thread->joinable()) {
-            continue;
-        }
-        
-        if (std::chrono::steady_clock::now() >= timeout_point) {
-            // If timeout reached, detach remaining threads
-            LOG_WARNING("Thread join timeout reached, detaching remaining threads");
-            thread->detach();
-            continue;
-        }
-        
-        // Try using timeout join
-        bool joined = false;
-        try {
-            // Create future and promise for timeout join
-            std::promise<void> thread_done;
-            auto future = thread_done.get_future();
-            
-            // Try join in another thread
-            std::thread join_helper([&thread, &thread_done]() {
-                try {
-                    thread->join();
-                    thread_done.set_value();
-                } catch (...) {
-                    try {
-                        thread_done.set_exception(std::current_exception());
-                    } catch (...) {}
-                }
-            });
-            
-            // Wait for join to complete or timeout
-            if (future.wait_for(std::chrono::milliseconds(100)) == std::future_status::ready) {
-                future.get(); // Get possible exception
-                joined = true;
-            }
-            
-            // Process join_helper thread
-            if (join_helper.joinable()) {
-                if (joined) {
-                    join_helper.join();
-                } else {
-                    join_helper.detach();
-                }
-            }
-        } catch (...) {
-            joined = false;
-        }
-        
-        // If join fails, then detach
-        if (!joined) {
-            try {
-                thread->detach();
-            } catch (...) {
-                // Ignore exceptions
-            }
-        }
-    }
-    
+    http_server_->stop();
     if (server_thread_ && server_thread_->joinable()) {
-        http_server_->stop();
         try {
             server_thread_->join();
         } catch (...) {
             server_thread_->detach();
         }
-    } else {
-        http_server_->stop();
     }
     
     LOG_INFO("MCP server stopped");
@@ -315,6 +375,15 @@ void server::register_resource(const std::string& path, std::shared_ptr<resource
 void server::register_tool(const tool& tool, tool_handler handler) {
     std::lock_guard<std::mutex> lock(mutex_);
     tools_[tool.name] = std::make_pair(tool, handler);
+
+    metrics& registry = metrics::instance();
+    const std::string labels = metrics::labels({{"tool", tool.name}});
+    tool_metrics_[tool.name] = {
+        &registry.histogram("mcp_tool_call_seconds", labels),
+        &registry.counter("mcp_tool_errors_total", labels),
+        &registry.counter("mcp_tool_received_bytes_total", labels),
+        &registry.counter("mcp_tool_sent_bytes_total", labels)
+    };
     
     // Register methods for tool listing and calling
     if (method_handlers_.find("tools/list") == method_handlers_.end()) {
@@ -339,13 +408,19 @@ void server::register_tool(const tool& tool, tool_handler handler) {
                 throw mcp_exception(error_code::invalid_params, "Tool not found: " + tool_name);
             }
             
-            json tool_args = params.contains("arguments") ? params["arguments"] : json::array();
-
-            if (tool_args.is_string()) {
-                try {
-                    tool_args = json::parse(tool_args.get<std::string>());
-                } catch (const json::exception& e) {
-                    throw mcp_exception(error_code::invalid_params, "Invalid JSON arguments: " + std::string(e.what()));
+            // The arguments are used in place, unless they were sent as a JSON string
+            json parsed_args = json::array();
+            const json* tool_args = &parsed_args;
+            if (params.contains("arguments")) {
+                const json& arguments = params["arguments"];
+                if (arguments.is_string()) {
+                    try {
+                        parsed_args = json::parse(arguments.get_ref<const std::string&>());
+                    } catch (const json::exception& e) {
+                        throw mcp_exception(error_code::invalid_params, "Invalid JSON arguments: " + std::string(e.what()));
+                    }
+                } else {
+                    tool_args = &arguments;
                 }
             }
 
@@ -353,9 +428,13 @@ void server::register_tool(const tool& tool, tool_handler handler) {
                 {"isError", false}
             };
 
+            const tool_metrics& call_metrics = tool_metrics_.at(tool_name);
+            MCP_TRACE_SCOPE_DETAIL("mcp", "tools/call", tool_name);
             try {
-                tool_result["content"] = it->second.second(tool_args, session_id);
+                scoped_timer timer(*call_metrics.duration);
+                tool_result["content"] = it->second.second(*tool_args, session_id);
             } catch (const std::exception& e) {
+                call_metrics.errors->add();
                 tool_result["isError"] = true;
                 tool_result["content"] = json::array({
                     {
@@ -370,6 +449,21 @@ void server::register_tool(const tool& tool, tool_handler handler) {
     }
 }
 
+void server::set_raw_argument(const std::string& tool_name, const std::string& argument) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    raw_arguments_[tool_name] = argument;
+}
+
+void server::set_metrics_endpoint(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    metrics_endpoint_ = path;
+}
+
+void server::set_trace_endpoint(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    trace_endpoint_ = path;
+}
+
 void server::register_session_cleanup(const std::string& key, session_cleanup_handler handler) {
     std::lock_guard<std::mutex> lock(mutex_);
     session_cleanup_handler_[key] = handler;
@@ -413,56 +507,12 @@ void server::handle_sse(const httplib::Request& req, httplib::Response& res) {
         session_dispatchers_[session_id] = session_dispatcher;
     }
     
-    // Create session thread
-    auto thread = std::make_unique<std::thread>([this, res, session_id, session_uri, session_dispatcher]() {
-        try {
-            // Send initial session URI
-            std::this_thread::sleep_for(std::chrono::milliseconds(500));
-            std::stringstream ss;
-            ss << "event: endpoint\r\ndata: " << session_uri << "\r\n\r\n";
-            session_dispatcher->send_event(ss.str());
-            
-            // Update activity time (after sending message)
-            session_dispatcher->update_activity();
-            
-            // Send periodic heartbeats to detect connection status
-            int heartbeat_count = 0;
-            while (running_ && !session_dispatcher->is_closed()) {
-               std::this_thread::sleep_for(std::chrono::seconds(5) + std::chrono::milliseconds(rand() % 500)); // NOTE: DO NOT set it the same as the timeout of wait_event
-                
-                if (session_dispatcher->is_closed() || !running_) {
-                    break;
-                }
-                
-                std::stringstream heartbeat;
-                heartbeat << "event: heartbeat\r\ndata: " << heartbeat_count++ << "\r\n\r\n";
-                
-                try {
-                    bool sent = session_dispatcher->send_event(heartbeat.str());
-                    if (!sent) {
-                        LOG_WARNING("Failed to send heartbeat, client may have closed connection: ", session_id);
-                        break;
-                    }
-                    
-                    // Update activity time (heartbeat successful)
-                    session_dispatcher->update_activity();
-                } catch (const std::exception& e) {
-                    LOG_ERROR("Failed to send heartbeat: ", e.what());
-                    break;
-                }
-            }
-        } catch (const std::exception& e) {
-            LOG_ERROR("SSE session thread exception: ", session_id, ", ", e.what());
-        }
-        
-        close_session(session_id);
-    });
+    // Announce the message endpoint; it is written as soon as the stream starts
+    std::stringstream ss;
+    ss << "event: endpoint\r\ndata: " << session_uri << "\r\n\r\n";
+    session_dispatcher->send_event(ss.str());
     
-    // Store thread
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        sse_threads_[session_id] = std::move(thread);
-    }
+    schedule_heartbeat(session_id, 0);
     
     // Setup chunked content provider
     res.set_chunked_content_provider("text/event-stream", [this, session_id, session_dispatcher](size_t /* offset */, httplib::DataSink& sink) {
@@ -499,7 +549,7 @@ void server::handle_sse(const httplib::Request& req, httplib::Response& res) {
     });
 }
 
-void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res) {
+void server::handle_jsonrpc(const httplib::Request& req, std::vector<uint8_t> body, httplib::Response& res) {
     // Setup response headers
     res.set_header("Content-Type", "application/json");
     res.set_header("Access-Control-Allow-Origin", "*");
@@ -532,10 +582,49 @@ void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res)
         }
     }
     
-    // Parse request
+    const size_t request_size = body.size();
+    received_bytes_.add(request_size);
+
+    // Find a tool argument that is to be passed on unparsed
+    const std::string_view body_text(reinterpret_cast<const char*>(body.data()), body.size());
+    std::string raw_name;
+    std::string_view raw_value;
+    {
+        std::string_view method, params, tool_name, arguments;
+        if (find_member(body_text, "method", method) && method == "\"tools/call\"" && find_member(body_text, "params", params) &&
+            find_member(params, "name", tool_name) && plain_string(tool_name, tool_name) &&
+            find_member(params, "arguments", arguments)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                auto raw_it = raw_arguments_.find(std::string(tool_name));
+                if (raw_it != raw_arguments_.end()) {
+                    raw_name = raw_it->second;
+                }
+            }
+            if (raw_name.empty() || !find_member(arguments, raw_name, raw_value)) {
+                raw_name.clear();
+            }
+        }
+    }
+
+    // Parse request. A raw argument is kept as its text, which the tool validates as it decodes it; the rest of the
+    // request is parsed with null in its place.
     json req_json;
     try {
-        req_json = json::parse(req.body);
+        if (raw_name.empty()) {
+            req_json = json::parse(body_text);
+        } else {
+            const size_t raw_offset = static_cast<size_t>(raw_value.data() - body_text.data());
+            const size_t raw_end = raw_offset + raw_value.size();
+            std::string envelope;
+            envelope.reserve(body.size() - raw_value.size() + 4);
+            envelope.append(body_text.substr(0, raw_offset)).append("null").append(body_text.substr(raw_end));
+            req_json = json::parse(envelope);
+            // The body is cut down to the argument in place and becomes its value, so the argument is never copied
+            body.erase(body.begin() + static_cast<std::ptrdiff_t>(raw_end), body.end());
+            body.erase(body.begin(), body.begin() + static_cast<std::ptrdiff_t>(raw_offset));
+            req_json["params"]["arguments"][raw_name] = json::binary(std::move(body));
+        }
     } catch (const json::exception& e) {
         LOG_ERROR("Failed to parse JSON request: ", e.what());
         res.status = 400;
@@ -572,7 +661,7 @@ void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res)
         }
         mcp_req.method = req_json["method"].get<std::string>();
         if (req_json.contains("params")) {
-            mcp_req.params = req_json["params"];
+            mcp_req.params = std::move(req_json["params"]);
         }
     } catch (const std::exception& e) {
         LOG_ERROR("Failed to create request object: ", e.what());
@@ -584,7 +673,10 @@ void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res)
     // If it is a notification (no ID), process it directly and return 202 status code
     if (mcp_req.is_notification()) {
         // Process it asynchronously in the thread pool
-        thread_pool_.enqueue([this, mcp_req, session_id]() {
+        thread_pool_.enqueue([this, mcp_req, session_id, enqueued = std::chrono::steady_clock::now()]() {
+            const auto dequeued = std::chrono::steady_clock::now();
+            queue_wait_time_.record(dequeued - enqueued);
+            MCP_TRACE_SPAN("mcp", "queue wait", enqueued, dequeued);
             process_request(mcp_req, session_id);
         });
         
@@ -595,14 +687,33 @@ void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res)
     }
     
     // For requests with ID, process it asynchronously in the thread pool and return the result via SSE
-    thread_pool_.enqueue([this, mcp_req, session_id, dispatcher]() {
+    thread_pool_.enqueue([this, mcp_req = std::move(mcp_req), session_id, dispatcher,
+                          enqueued = std::chrono::steady_clock::now(), request_size]() {
+        const auto dequeued = std::chrono::steady_clock::now();
+        queue_wait_time_.record(dequeued - enqueued);
+        MCP_TRACE_SPAN("mcp", "queue wait", enqueued, dequeued);
+
         // Process the request
         json response_json = process_request(mcp_req, session_id);
         
-        // Send response via SSE
-        std::stringstream ss;
-        ss << "event: message\r\ndata: " << response_json.dump() << "\r\n\r\n";
-        bool result = dispatcher->send_event(ss.str());
+        // Send response via SSE. The response is serialized once, straight into the event
+        std::string event;
+        {
+            MCP_TRACE_SCOPE("mcp", "json::dump");
+            scoped_timer encode_timer(response_encode_time_);
+            event = "event: message\r\ndata: ";
+            event += response_json.dump();
+            event += "\r\n\r\n";
+        }
+
+        if (mcp_req.method == "tools/call") {
+            if (tool_metrics* call_metrics = find_tool_metrics(mcp_req.params)) {
+                call_metrics->received_bytes->add(request_size);
+                call_metrics->sent_bytes->add(event.size());
+            }
+        }
+
+        bool result = dispatcher->send_event(std::move(event));
         
         if (!result) {
             LOG_ERROR("Failed to send response via SSE: session_id=", session_id);
@@ -614,6 +725,16 @@ void server::handle_jsonrpc(const httplib::Request& req, httplib::Response& res)
     res.set_content("Accepted", "text/plain");
 }
 
+server::tool_metrics* server::find_tool_metrics(const json& params) {
+    auto name = params.find("name");
+    if (name == params.end() || !name->is_string()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tool_metrics_.find(name->get_ref<const std::string&>());
+    return it != tool_metrics_.end() ? &it->second : nullptr;
+}
+
 json server::process_request(const request& req, const std::string& session_id) {
     // Check if it is a notification
     if (req.is_notification()) {
@@ -654,16 +775,14 @@ json server::process_request(const request& req, const std::string& session_id)
         }
         
         if (handler) {
-            // Call handler
+            // Call handler. process_request already runs on a pool worker, so the handler runs on the same worker
+            // rather than being queued behind other requests while this worker waits for it.
             LOG_INFO("Calling method handler: ", req.method);
-            auto future = thread_pool_.enqueue([handler, params = req.params, session_id]() -> json {
-                return handler(params, session_id);
-            });
-            json result = future.get();
+            json result = handler(req.params, session_id);
             
             // Create success response
             LOG_INFO("Method call successful: ", req.method);
-            return response::create_success(req.id, result).to_json();
+            return response::create_success(req.id, std::move(result)).to_json();
         }
         
         // Method not found
@@ -886,8 +1005,8 @@ void server::check_inactive_sessions() {
     {
         std::lock_guard<std::mutex> lock(mutex_);
         for (const auto& [session_id, dispatcher] : session_dispatchers_) {
-            if (now - dispatcher->last_activity() > timeout) {
-                // Exceeded idle time limit
+            if (dispatcher->is_closed() || now - dispatcher->last_activity() > timeout) {
+                // Connection gone or exceeded idle time limit
                 sessions_to_close.push_back(session_id);
             }
         }
@@ -901,6 +1020,86 @@ void server::check_inactive_sessions() {
     }
 }
 
+void server::run_session_loop() {
+    const auto cleanup_interval = std::chrono::seconds(60);
+    auto next_cleanup = std::chrono::steady_clock::now() + cleanup_interval;
+    
+    std::unique_lock<std::mutex> lock(session_loop_mutex_);
+    while (running_) {
+        auto next_wakeup = next_cleanup;
+        if (!session_timers_.empty() && session_timers_.top().due < next_wakeup) {
+            next_wakeup = session_timers_.top().due;
+        }
+        session_loop_cv_.wait_until(lock, next_wakeup);
+        if (!running_) {
+            break;
+        }
+        
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<session_timer> due_timers;
+        while (!session_timers_.empty() && session_timers_.top().due <= now) {
+            due_timers.push_back(session_timers_.top());
+            session_timers_.pop();
+        }
+        const bool cleanup = now >= next_cleanup;
+        if (cleanup) {
+            next_cleanup = now + cleanup_interval;
+        }
+        
+        // Sending and closing sessions take other locks, so release ours meanwhile
+        lock.unlock();
+        for (const auto& timer : due_timers) {
+            send_heartbeat(timer);
+        }
+        if (cleanup) {
+            try {
+                check_inactive_sessions();
+            } catch (const std::exception& e) {
+                LOG_ERROR("Exception in session loop: ", e.what());
+            } catch (...) {
+                LOG_ERROR("Unknown exception in session loop");
+            }
+        }
+        lock.lock();
+    }
+}
+
+void server::schedule_heartbeat(const std::string& session_id, int heartbeat_count) {
+    // NOTE: DO NOT set the interval the same as the timeout of wait_event
+    const auto interval = std::chrono::seconds(5) + std::chrono::milliseconds(rand() % 500);
+    {
+        std::lock_guard<std::mutex> lock(session_loop_mutex_);
+        session_timers_.push({std::chrono::steady_clock::now() + interval, session_id, heartbeat_count});
+    }
+    session_loop_cv_.notify_one();
+}
+
+void server::send_heartbeat(const session_timer& timer) {
+    std::shared_ptr<event_dispatcher> dispatcher;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = session_dispatchers_.find(timer.session_id);
+        if (it != session_dispatchers_.end()) {
+            dispatcher = it->second;
+        }
+    }
+    if (!dispatcher) {
+        return; // Session already closed
+    }
+    
+    std::stringstream heartbeat;
+    heartbeat << "event: heartbeat\r\ndata: " << timer.heartbeat_count << "\r\n\r\n";
+    if (!dispatcher->send_event(heartbeat.str())) {
+        LOG_WARNING("Failed to send heartbeat, client may have closed connection: ", timer.session_id);
+        close_session(timer.session_id);
+        return;
+    }
+    
+    // Activity is only refreshed when the stream actually delivers events, so a session whose client went away
+    // without closing the connection is eventually closed by check_inactive_sessions
+    schedule_heartbeat(timer.session_id, timer.heartbeat_count + 1);
+}
+
 bool server::set_mount_point(const std::string& mount_point, const std::string& dir, httplib::Headers headers) {
     return http_server_->set_mount_point(mount_point, dir, headers);
 }
@@ -908,13 +1107,9 @@ bool server::set_mount_point(const std::string& mount_point, const std::string&
 void server::close_session(const std::string& session_id) {
      // Clean up resources safely
     try {
-        for (const auto& [key, handler] : session_cleanup_handler_) {
-            handler(key);
-        }
-
         // Copy resources to be processed
         std::shared_ptr<event_dispatcher> dispatcher_to_close;
-        std::unique_ptr<std::thread> thread_to_release;
+        std::vector<session_cleanup_handler> cleanup_handlers;
         
         {
             std::lock_guard<std::mutex> lock(mutex_);
@@ -924,28 +1119,30 @@ void server::close_session(const std::string& session_id) {
             if (dispatcher_it != session_dispatchers_.end()) {
                 dispatcher_to_close = dispatcher_it->second;
                 session_dispatchers_.erase(dispatcher_it);
-            }
-            
-            // Get thread pointer
-            auto thread_it = sse_threads_.find(session_id);
-            if (thread_it != sse_threads_.end()) {
-                thread_to_release = std::move(thread_it->second);
-                sse_threads_.erase(thread_it);
+
+                // Only the call that removes the session runs the cleanup handlers
+                for (const auto& [key, handler] : session_cleanup_handler_) {
+                    cleanup_handlers.push_back(handler);
+                }
             }
             
             // Clean up initialization status
             session_initialized_.erase(session_id);
         }
         
+        // Run cleanup handlers outside the lock, they may call back into the server
+        for (const auto& handler : cleanup_handlers) {
+            try {
+                handler(session_id);
+            } catch (const std::exception& e) {
+                LOG_WARNING("Session cleanup handler failed: ", session_id, ", ", e.what());
+            }
+        }
+        
         // Close dispatcher outside the lock
         if (dispatcher_to_close && !dispatcher_to_close->is_closed()) {
             dispatcher_to_close->close();
         }
-        
-        // Release thread resources
-        if (thread_to_release) {
-            thread_to_release.release();
-        }
     } catch (const std::exception& e) {
         LOG_WARNING("Exception while cleaning up session resources: ", session_id, ", ", e.what());
     } catch (...) {
@@ -0,0 +1,104 @@
+/**
+ * @file mcp_trace.cpp
+ * @brief Implementation of the trace buffer
+ */
+
+#include "mcp_trace.h"
+#include "mcp_message.h"
+
+#include <atomic>
+#include <cstdio>
+
+namespace mcp {
+
+namespace {
+
+// Microseconds with nanosecond precision, as trace viewers expect
+void append_microseconds(std::string& out, std::chrono::nanoseconds duration) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(duration.count()) / 1000.0);
+    out.append(buffer, length > 0 ? static_cast<size_t>(length) : 0);
+}
+
+} // namespace
+
+trace_buffer::trace_buffer() : epoch_(clock::now()) {
+}
+
+trace_buffer& trace_buffer::instance() {
+    static trace_buffer instance;
+    return instance;
+}
+
+uint32_t trace_buffer::current_thread() {
+    static std::atomic<uint32_t> next_thread{1};
+    thread_local const uint32_t thread = next_thread.fetch_add(1, std::memory_order_relaxed);
+    return thread;
+}
+
+void trace_buffer::record(const char* category, const char* name, std::string detail, clock::time_point start, clock::time_point end) {
+    event span{category, name, std::move(detail), start, end, current_thread()};
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (capacity_ == 0) {
+        return;
+    }
+    if (events_.size() < capacity_) {
+        events_.push_back(std::move(span));
+        return;
+    }
+    events_[next_] = std::move(span);
+    next_ = (next_ + 1) % capacity_;
+}
+
+std::string trace_buffer::to_chrome_json() const {
+    std::vector<event> events;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events.reserve(events_.size());
+        events.insert(events.end(), events_.begin() + static_cast<std::ptrdiff_t>(next_), events_.end());
+        events.insert(events.end(), events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(next_));
+    }
+
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const event& span : events) {
+        if (!first) {
+            out += ',';
+        }
+        first = false;
+        out += "{\"ph\":\"X\",\"pid\":1,\"tid\":";
+        out += std::to_string(span.thread);
+        out += ",\"cat\":";
+        out += json(span.category).dump();
+        out += ",\"name\":";
+        out += json(span.name).dump();
+        out += ",\"ts\":";
+        append_microseconds(out, span.start - epoch_);
+        out += ",\"dur\":";
+        append_microseconds(out, span.end - span.start);
+        if (!span.detail.empty()) {
+            out += ",\"args\":{\"detail\":";
+            out += json(span.detail).dump(-1, ' ', false, json::error_handler_t::replace);
+            out += '}';
+        }
+        out += '}';
+    }
+    out += "]}";
+    return out;
+}
+
+void trace_buffer::set_capacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    events_.clear();
+    events_.shrink_to_fit();
+    next_ = 0;
+}
+
+void trace_buffer::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    next_ = 0;
+}
+
+} // namespace mcp
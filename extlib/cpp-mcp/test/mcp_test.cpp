@@ -658,6 +658,364 @@ TEST_F(ToolsTest, CallTool) {
     EXPECT_EQ(tool_result["content"][0]["text"], "Current weather in New York:\nTemperature: 72°F\nConditions: Partly cloudy");
 }
 
+// Concurrency test environment
+class ConcurrencyEnvironment : public ::testing::Environment {
+public:
+    void SetUp() override {
+        // Set up test environment
+        server_ = std::make_unique<server>("localhost", 8084);
+        
+        // Register a tool that keeps its worker busy for a while
+        tool slow_tool = tool_builder("slow_echo")
+                             .with_description("Echo a value after a short delay")
+                             .with_number_param("value", "The value to echo")
+                             .build();
+        server_->register_tool(slow_tool, [](const json& params, const std::string& /* session_id */) -> json {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            return json::array({
+                {
+                    {"type", "text"},
+                    {"text", std::to_string(params["value"].get<int>())}
+                }
+            });
+        });
+        
+        // Start server (non-blocking mode)
+        server_->start(false);
+    }
+
+    void TearDown() override {
+        // Clean up test environment
+        server_->stop();
+        server_.reset();
+    }
+
+    static std::unique_ptr<server>& GetServer() {
+        return server_;
+    }
+
+private:
+    static std::unique_ptr<server> server_;
+};
+
+// Static member variable definition
+std::unique_ptr<server> ConcurrencyEnvironment::server_;
+
+// Test many concurrent tool calls on one session. Every request is dispatched to the server's thread pool; a
+// handler that was queued again behind the other requests would leave all workers waiting and never answer.
+TEST(ConcurrencyTest, ConcurrentToolCalls) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    const int call_count = 4 * static_cast<int>((std::max)(1u, std::thread::hardware_concurrency()));
+
+    std::unique_ptr<httplib::Client> sse_client = std::make_unique<httplib::Client>("localhost", 8084);
+
+    // Collect the responses arriving on the SSE stream by request id
+    std::promise<std::string> msg_endpoint_promise;
+    std::future<std::string> msg_endpoint = msg_endpoint_promise.get_future();
+    std::mutex responses_mutex;
+    std::condition_variable responses_cv;
+    std::map<int, json> responses;
+    std::atomic<bool> sse_running{true};
+    std::atomic<bool> msg_endpoint_received{false};
+
+    std::thread sse_thread([&]() {
+        std::string buffer;
+        sse_client->Get("/sse", [&](const char* data, size_t len) {
+            buffer.append(data, len);
+            size_t end;
+            while ((end = buffer.find("\r\n\r\n")) != std::string::npos) {
+                std::string event = buffer.substr(0, end);
+                buffer.erase(0, end + 4);
+
+                size_t pos = event.find("data: ");
+                if (pos == std::string::npos) {
+                    continue;
+                }
+                std::string data_content = event.substr(pos + 6);
+                if (event.find("event: endpoint") != std::string::npos) {
+                    if (!msg_endpoint_received.exchange(true)) {
+                        msg_endpoint_promise.set_value(data_content);
+                    }
+                } else if (event.find("event: message") != std::string::npos) {
+                    try {
+                        json message = json::parse(data_content);
+                        if (message.contains("id") && message["id"].is_number_integer()) {
+                            std::lock_guard<std::mutex> lock(responses_mutex);
+                            responses[message["id"].get<int>()] = message;
+                            responses_cv.notify_all();
+                        }
+                    } catch (const std::exception& e) {
+                        GTEST_LOG_(ERROR) << "SSE processing error: " << e.what();
+                    }
+                }
+            }
+            return sse_running.load();
+        });
+    });
+
+    // Close the SSE connection when the test ends, also after a failed assertion
+    std::shared_ptr<void> sse_closer(nullptr, [&](void*) {
+        sse_running.store(false);
+        sse_client->stop();
+        if (sse_thread.joinable()) {
+            sse_thread.join();
+        }
+    });
+
+    auto wait_for_responses = [&](size_t count, std::chrono::seconds timeout) {
+        std::unique_lock<std::mutex> lock(responses_mutex);
+        return responses_cv.wait_for(lock, timeout, [&] { return responses.size() >= count; });
+    };
+
+    ASSERT_EQ(msg_endpoint.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::string endpoint = msg_endpoint.get();
+
+    // Initialize the session
+    httplib::Client http_client("localhost", 8084);
+    json init_req = {
+        {"jsonrpc", "2.0"},
+        {"id", 0},
+        {"method", "initialize"},
+        {"params", {
+            {"protocolVersion", MCP_VERSION},
+            {"capabilities", json::object()},
+            {"clientInfo", {{"name", "TestClient"}, {"version", "1.0.0"}}}
+        }}
+    };
+    auto init_res = http_client.Post(endpoint.c_str(), init_req.dump(), "application/json");
+    ASSERT_TRUE(init_res != nullptr);
+    ASSERT_TRUE(wait_for_responses(1, std::chrono::seconds(5)));
+    json initialized = request::create_notification("initialized").to_json();
+    http_client.Post(endpoint.c_str(), initialized.dump(), "application/json");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Fire all tool calls at once
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> callers;
+    for (int i = 1; i <= call_count; ++i) {
+        callers.emplace_back([&endpoint, i]() {
+            httplib::Client client("localhost", 8084);
+            json call_req = {
+                {"jsonrpc", "2.0"},
+                {"id", i},
+                {"method", "tools/call"},
+                {"params", {{"name", "slow_echo"}, {"arguments", {{"value", i}}}}}
+            };
+            auto res = client.Post(endpoint.c_str(), call_req.dump(), "application/json");
+            EXPECT_TRUE(res != nullptr);
+            if (res) {
+                EXPECT_EQ(res->status, 202);
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    // With every worker busy the calls complete in waves of 200 ms; allow generous slack for slow machines
+    EXPECT_TRUE(wait_for_responses(call_count + 1, std::chrono::seconds(30)));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    GTEST_LOG_(INFO) << call_count << " concurrent tool calls took "
+                     << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << " ms";
+
+    {
+        std::lock_guard<std::mutex> lock(responses_mutex);
+        for (int i = 1; i <= call_count; ++i) {
+            auto it = responses.find(i);
+            ASSERT_TRUE(it != responses.end()) << "No response for request " << i;
+            ASSERT_TRUE(it->second.contains("result")) << it->second.dump();
+            EXPECT_FALSE(it->second["result"]["isError"]);
+            EXPECT_EQ(it->second["result"]["content"][0]["text"], std::to_string(i));
+        }
+    }
+}
+
+// Test that session cleanup handlers are called with the ID of the closed session, once per handler
+TEST(SessionCleanupTest, HandlerReceivesSessionId) {
+    server cleanup_server("localhost", 8085);
+    cleanup_server.set_server_info("TestServer", "1.0.0");
+
+    std::mutex cleaned_mutex;
+    std::vector<std::string> cleaned_sessions;
+    cleanup_server.register_session_cleanup("test_resource", [&](const std::string& session_id) {
+        std::lock_guard<std::mutex> lock(cleaned_mutex);
+        cleaned_sessions.push_back(session_id);
+    });
+    cleanup_server.start(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    std::unique_ptr<httplib::Client> sse_client = std::make_unique<httplib::Client>("localhost", 8085);
+    std::promise<std::string> msg_endpoint_promise;
+    std::future<std::string> msg_endpoint = msg_endpoint_promise.get_future();
+    std::atomic<bool> msg_endpoint_received{false};
+    std::atomic<bool> sse_running{true};
+
+    std::thread sse_thread([&]() {
+        sse_client->Get("/sse", [&](const char* data, size_t len) {
+            std::string event(data, len);
+            size_t pos = event.find("data: ");
+            if (event.find("event: endpoint") != std::string::npos && pos != std::string::npos) {
+                size_t end = event.find("\r\n", pos);
+                if (!msg_endpoint_received.exchange(true)) {
+                    msg_endpoint_promise.set_value(event.substr(pos + 6, end - pos - 6));
+                }
+            }
+            return sse_running.load();
+        });
+    });
+
+    std::shared_ptr<void> sse_closer(nullptr, [&](void*) {
+        sse_running.store(false);
+        sse_client->stop();
+        if (sse_thread.joinable()) {
+            sse_thread.join();
+        }
+    });
+
+    ASSERT_EQ(msg_endpoint.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    std::string endpoint = msg_endpoint.get();
+    size_t id_pos = endpoint.find("session_id=");
+    ASSERT_NE(id_pos, std::string::npos) << endpoint;
+    std::string session_id = endpoint.substr(id_pos + 11);
+
+    // Stopping the server closes every open session
+    cleanup_server.stop();
+
+    std::lock_guard<std::mutex> lock(cleaned_mutex);
+    ASSERT_EQ(cleaned_sessions.size(), 1u);
+    EXPECT_EQ(cleaned_sessions[0], session_id);
+}
+
+// Test that an argument registered as raw reaches the tool as its JSON text, and other arguments as usual
+TEST(RawArgumentTest, HandlerReceivesArgumentText) {
+    server raw_server("localhost", 8086);
+    raw_server.set_server_info("TestServer", "1.0.0");
+
+    tool sum_tool = tool_builder("sum_rows")
+                        .with_description("Sum a list of rows")
+                        .with_string_param("label", "A label for the result")
+                        .with_array_param("rows", "Rows of numbers", "array")
+                        .build();
+    raw_server.register_tool(sum_tool, [](const json& params, const std::string& /* session_id */) -> json {
+        EXPECT_TRUE(params["rows"].is_binary());
+        const json::binary_t& text = params["rows"].get_binary();
+        json rows = json::parse(text.begin(), text.end());
+        int sum = 0;
+        for (const auto& row : rows) {
+            for (const auto& value : row) {
+                sum += value.get<int>();
+            }
+        }
+        return json::array({{{"type", "text"}, {"text", params["label"].get<std::string>() + std::to_string(sum)}}});
+    });
+    raw_server.set_raw_argument("sum_rows", "rows");
+    raw_server.start(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    sse_client client("localhost", 8086);
+    ASSERT_TRUE(client.initialize("TestClient", "1.0.0"));
+
+    json result = client.call_tool("sum_rows", {{"rows", json::array({json::array({1, 2}), json::array({3, "x,]}"})})},
+                                                {"label", "sum: "}});
+    EXPECT_TRUE(result["isError"]);
+
+    result = client.call_tool("sum_rows", {{"rows", json::array({json::array({1, 2}), json::array({3, 4})})}, {"label", "sum: "}});
+    EXPECT_FALSE(result["isError"]);
+    EXPECT_EQ(result["content"][0]["text"], "sum: 10");
+
+    raw_server.stop();
+}
+
+TEST(MetricsTest, HistogramQuantiles) {
+    latency_histogram histogram;
+    for (int i = 1; i <= 100; ++i) {
+        histogram.record(std::chrono::milliseconds(i));
+    }
+    latency_histogram::snapshot snapshot = histogram.read();
+    EXPECT_EQ(snapshot.count, 100u);
+    EXPECT_NEAR(snapshot.sum_seconds, 5.05, 1e-9);
+    // Buckets are at most 12.5% wide, and a quantile is reported as the upper bound of its bucket
+    EXPECT_GE(snapshot.quantile(0.5), 0.050);
+    EXPECT_LE(snapshot.quantile(0.5), 0.050 * 1.125);
+    EXPECT_GE(snapshot.quantile(0.99), 0.099);
+    EXPECT_LE(snapshot.quantile(0.99), 0.099 * 1.125);
+
+    for (uint64_t us : {0ull, 7ull, 8ull, 1000ull, 123456789ull}) {
+        size_t index = latency_histogram::bucket_index(us);
+        EXPECT_LT(us, latency_histogram::bucket_upper_bound(index));
+        EXPECT_TRUE(index == 0 || us >= latency_histogram::bucket_upper_bound(index - 1));
+    }
+    EXPECT_EQ(latency_histogram::bucket_index(~0ull), latency_histogram::bucket_count - 1);
+}
+
+TEST(MetricsTest, EndpointReportsToolCalls) {
+    server metrics_server("localhost", 8087);
+    metrics_server.set_server_info("TestServer", "1.0.0");
+    metrics_server.set_metrics_endpoint("/metrics");
+
+    tool fail_tool = tool_builder("metrics_fail")
+                         .with_description("Fail when asked to")
+                         .with_boolean_param("fail", "Whether to fail")
+                         .build();
+    metrics_server.register_tool(fail_tool, [](const json& params, const std::string& /* session_id */) -> json {
+        if (params["fail"].get<bool>()) {
+            throw mcp_exception(error_code::internal_error, "Failed as asked");
+        }
+        return json::array({{{"type", "text"}, {"text", "ok"}}});
+    });
+    metrics_server.register_resource("metrics://prometheus", std::make_shared<metrics_resource>());
+    metrics_server.start(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    sse_client client("localhost", 8087);
+    ASSERT_TRUE(client.initialize("TestClient", "1.0.0"));
+    client.call_tool("metrics_fail", {{"fail", false}});
+    client.call_tool("metrics_fail", {{"fail", false}});
+    client.call_tool("metrics_fail", {{"fail", true}});
+
+    httplib::Client http("localhost", 8087);
+    auto res = http.Get("/metrics");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res->status, 200);
+    EXPECT_THAT(res->body, ::testing::HasSubstr("# TYPE mcp_tool_call_seconds summary\n"));
+    EXPECT_THAT(res->body, ::testing::HasSubstr("mcp_tool_call_seconds_count{tool=\"metrics_fail\"} 3\n"));
+    EXPECT_THAT(res->body, ::testing::HasSubstr("mcp_tool_errors_total{tool=\"metrics_fail\"} 1\n"));
+    EXPECT_THAT(res->body, ::testing::HasSubstr("mcp_queue_wait_seconds_count"));
+
+    json contents = client.read_resource("metrics://prometheus");
+    EXPECT_THAT(contents["contents"][0]["text"].get<std::string>(),
+                ::testing::HasSubstr("mcp_tool_errors_total{tool=\"metrics_fail\"} 1\n"));
+
+    metrics_server.stop();
+}
+
+TEST(TraceTest, RingBufferKeepsNewestSpans) {
+    trace_buffer& buffer = trace_buffer::instance();
+    buffer.set_capacity(2);
+
+    auto start = trace_buffer::clock::now();
+    buffer.record("test", "first", "", start, start + std::chrono::microseconds(5));
+    buffer.record("test", "second", "", start, start + std::chrono::microseconds(5));
+    {
+        trace_scope scope("test", "third", "sheet \"1\"");
+    }
+
+    json trace = json::parse(buffer.to_chrome_json());
+    ASSERT_EQ(trace["traceEvents"].size(), 2u);
+    EXPECT_EQ(trace["traceEvents"][0]["name"], "second");
+    EXPECT_EQ(trace["traceEvents"][0]["ph"], "X");
+    EXPECT_DOUBLE_EQ(trace["traceEvents"][0]["dur"].get<double>(), 5.0);
+    EXPECT_EQ(trace["traceEvents"][1]["name"], "third");
+    EXPECT_EQ(trace["traceEvents"][1]["cat"], "test");
+    EXPECT_EQ(trace["traceEvents"][1]["args"]["detail"], "sheet \"1\"");
+    EXPECT_EQ(trace["traceEvents"][0]["tid"], trace["traceEvents"][1]["tid"]);
+
+    buffer.clear();
+    EXPECT_TRUE(json::parse(buffer.to_chrome_json())["traceEvents"].empty());
+    buffer.set_capacity(65536);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     
@@ -666,6 +1024,7 @@ int main(int argc, char **argv) {
     ::testing::AddGlobalTestEnvironment(new VersioningEnvironment());
     ::testing::AddGlobalTestEnvironment(new PingEnvironment());
     ::testing::AddGlobalTestEnvironment(new ToolsEnvironment());
+    ::testing::AddGlobalTestEnvironment(new ConcurrencyEnvironment());
     
     return RUN_ALL_TESTS();
 } 
\ No newline at end of file
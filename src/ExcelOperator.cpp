@@ -1,7 +1,41 @@
 #include "ExcelOperator.h"
+#include "SheetRange.h"
+
+#include <algorithm>
+#include <tuple>
 
 namespace ExcelWrapper {
 
+ExcelOperator::StreamPosition::StreamPosition(const std::string& sheetName, uint16_t lastColumn,
+                                              OpenXLSX::XLStreamingSheetReader&& reader)
+    : sheetName(sheetName), lastColumn(lastColumn), reader(std::move(reader)) {
+}
+
+namespace {
+
+std::optional<uint32_t> argb(const std::optional<OpenXLSX::XLColor>& color) {
+    if (!color) {
+        return std::nullopt;
+    }
+    return (uint32_t(color->alpha()) << 24) | (uint32_t(color->red()) << 16) | (uint32_t(color->green()) << 8) | color->blue();
+}
+
+} // namespace
+
+bool CellStyleChange::empty() const {
+    return !horizontalAlignment && !changesFont() && !backgroundColor;
+}
+
+bool CellStyleChange::changesFont() const {
+    return bold || italic || underline || fontColor;
+}
+
+bool CellStyleChange::operator<(const CellStyleChange& other) const {
+    return std::make_tuple(horizontalAlignment, bold, italic, underline, argb(fontColor), argb(backgroundColor)) <
+           std::make_tuple(other.horizontalAlignment, other.bold, other.italic, other.underline, argb(other.fontColor),
+                           argb(other.backgroundColor));
+}
+
 ExcelOperator::ExcelOperator() : m_isOpen(false) {
 }
 
@@ -18,11 +52,13 @@ bool ExcelOperator::open(const std::string& filePath, std::vector<std::string>&
     m_document.open(filePath);
     m_workbook = m_document.workbook();
 
-    for (uint32_t i = 1; i <= m_workbook.sheetCount(); ++i) {
-        sheetNames.emplace_back(m_workbook.sheet(i).name());
-    }
+    // Sheet names come from workbook.xml, so no sheet is loaded here
+    const auto names = m_workbook.sheetNames();
+    sheetNames.insert(sheetNames.end(), names.begin(), names.end());
 
-    m_currentSheet = m_workbook.worksheet(1);
+    const auto worksheetNames = m_workbook.worksheetNames();
+    m_currentSheetName = worksheetNames.empty() ? std::string() : worksheetNames.front();
+    m_currentSheetLoaded = false;
     m_isOpen = true;
     return true;
 }
@@ -31,9 +67,11 @@ bool ExcelOperator::create(const std::string& filePath) {
     if (m_isOpen) {
         close();
     }
+    m_streamPosition.reset();
     m_document.create(filePath, OpenXLSX::XLForceOverwrite);
     m_workbook = m_document.workbook();
-    m_currentSheet = m_workbook.worksheet("Sheet1");
+    m_currentSheetName = "Sheet1";
+    m_currentSheetLoaded = false;
     m_isOpen = true;
     return true;
 }
@@ -42,6 +80,7 @@ bool ExcelOperator::save() {
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_document.save();
     return true;
 }
@@ -50,11 +89,18 @@ bool ExcelOperator::saveAs(const std::string& filePath) {
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_document.saveAs(filePath, OpenXLSX::XLForceOverwrite);
     return true;
 }
 
+void ExcelOperator::setSaveOptions(const OpenXLSX::XLZipSaveOptions& options) {
+    m_document.setSaveOptions(options);
+}
+
 bool ExcelOperator::close() {
+    m_streamPosition.reset();
+    m_styledFormats.clear();
     if (m_isOpen) {
         try {
             m_document.close();
@@ -71,7 +117,13 @@ bool ExcelOperator::selectSheet(const std::string& sheetName) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet = m_workbook.worksheet(sheetName);
+    if (!m_workbook.worksheetExists(sheetName)) {
+        return false;
+    }
+    if (sheetName != m_currentSheetName) {
+        m_currentSheetName = sheetName;
+        m_currentSheetLoaded = false;
+    }
     return true;
 }
 
@@ -79,7 +131,10 @@ bool ExcelOperator::selectSheet(uint32_t sheetIndex) {
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_currentSheet = m_workbook.worksheet(sheetIndex);
+    m_currentSheetName = m_currentSheet.name();
+    m_currentSheetLoaded = true;
     return true;
 }
 
@@ -87,6 +142,7 @@ bool ExcelOperator::addSheet(const std::string& sheetName) {
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_workbook.addWorksheet(sheetName);
     return true;
 }
@@ -95,6 +151,7 @@ bool ExcelOperator::deleteSheet(const std::string& sheetName) {
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_workbook.deleteSheet(sheetName);
     return true;
 }
@@ -103,7 +160,11 @@ bool ExcelOperator::renameSheet(const std::string& oldName, const std::string& n
     if (!m_isOpen) {
         return false;
     }
+    m_streamPosition.reset();
     m_workbook.worksheet(oldName).setName(newName);
+    if (oldName == m_currentSheetName) {
+        m_currentSheetName = newName;
+    }
     return true;
 }
 
@@ -114,18 +175,35 @@ uint32_t ExcelOperator::sheetCount() const {
     return m_workbook.sheetCount();
 }
 
+std::vector<std::string> ExcelOperator::sheetNames() const {
+    if (!m_isOpen) {
+        return {};
+    }
+    return m_workbook.sheetNames();
+}
+
 std::string ExcelOperator::currentSheetName() const {
     if (!m_isOpen) {
         return "";
     }
-    return m_currentSheet.name();
+    return m_currentSheetName;
+}
+
+OpenXLSX::XLWorksheet& ExcelOperator::currentSheet() const {
+    if (!m_currentSheetLoaded) {
+        // Edits go through the loaded sheet, so a streamed read position may be out of date from here on
+        m_streamPosition.reset();
+        m_currentSheet = m_document.workbook().worksheet(m_currentSheetName);
+        m_currentSheetLoaded = true;
+    }
+    return m_currentSheet;
 }
 
 bool ExcelOperator::clearCell(uint32_t row, uint32_t column) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.cell(row, column).clear(0);
+    currentSheet().cell(row, column).clear(0);
     return true;
 }
 
@@ -135,7 +213,7 @@ bool ExcelOperator::mergeCells(uint32_t firstRow, uint32_t firstColumn, uint32_t
     }
     OpenXLSX::XLCellReference topLeft(firstColumn, firstRow);
     OpenXLSX::XLCellReference bottomRight(lastColumn, lastRow);
-    m_currentSheet.mergeCells(m_currentSheet.range(topLeft, bottomRight));
+    currentSheet().mergeCells(currentSheet().range(topLeft, bottomRight));
     return true;
 }
 
@@ -145,194 +223,49 @@ bool ExcelOperator::unmergeCells(uint32_t firstRow, uint32_t firstColumn, uint32
     }
     OpenXLSX::XLCellReference topLeft(firstColumn, firstRow);
     OpenXLSX::XLCellReference bottomRight(lastColumn, lastRow);
-    m_currentSheet.unmergeCells(m_currentSheet.range(topLeft, bottomRight));
+    currentSheet().unmergeCells(currentSheet().range(topLeft, bottomRight));
     return true;
 }
 
 bool ExcelOperator::setCellFontColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setFontColor(OpenXLSX::XLColor(red, green, blue, alpha));
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFont(row, column, [&](OpenXLSX::XLFont& font) {
+        font.setFontColor(OpenXLSX::XLColor(alpha, red, green, blue));
+    });
 }
 
 bool ExcelOperator::setCellBackgroundColor(uint32_t row, uint32_t column, uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto fill = styles.fills()[currentFormat.fillIndex()];
-        auto newFill = fill;
-        newFill.setBackgroundColor(OpenXLSX::XLColor(red, green, blue, alpha));
-        auto newFillIndex = styles.fills().create(newFill);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFillIndex(newFillIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFill(row, column, [&](OpenXLSX::XLFill& fill) {
+        fill.setBackgroundColor(OpenXLSX::XLColor(alpha, red, green, blue));
+    });
 }
 
 bool ExcelOperator::setCellFontSize(uint32_t row, uint32_t column, uint16_t size) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setFontSize(size);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFont(row, column, [&](OpenXLSX::XLFont& font) {
+        font.setFontSize(size);
+    });
 }
 
 bool ExcelOperator::setCellFontBold(uint32_t row, uint32_t column, bool bold) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setBold(bold);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFont(row, column, [&](OpenXLSX::XLFont& font) {
+        font.setBold(bold);
+    });
 }
 
 bool ExcelOperator::setCellFontItalic(uint32_t row, uint32_t column, bool italic) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setItalic(italic);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFont(row, column, [&](OpenXLSX::XLFont& font) {
+        font.setItalic(italic);
+    });
 }
 
 bool ExcelOperator::setCellFontUnderline(uint32_t row, uint32_t column, bool underline) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        
-        auto font = styles.fonts()[currentFormat.fontIndex()];
-        auto newFont = font;
-        newFont.setUnderline(underline ? OpenXLSX::XLUnderlineSingle : OpenXLSX::XLUnderlineNone);
-        auto newFontIndex = styles.fonts().create(newFont);
-        
-        auto newFormat = currentFormat;
-        newFormat.setFontIndex(newFontIndex);
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
-        
-        cell.setCellFormat(newFormatIndex);
-        return true;
-    } catch (const std::exception& e) {
-        return false;
-    }
+    return updateCellFont(row, column, [&](OpenXLSX::XLFont& font) {
+        font.setUnderline(underline ? OpenXLSX::XLUnderlineSingle : OpenXLSX::XLUnderlineNone);
+    });
 }
 
 bool ExcelOperator::setCellAlignment(uint32_t row, uint32_t column, const std::string& horizontal, const std::string& vertical) {
-    if (!m_isOpen || row < 1 || column < 1) {
-        return false;
-    }
-    
-    try {
-        auto& styles = m_document.styles();
-        auto cell = m_currentSheet.cell(row, column);
-        
-        auto currentFormatIndex = cell.cellFormat();
-        auto currentFormat = styles.cellFormats()[currentFormatIndex];
-        auto newFormat = currentFormat;
-        
-        auto alignment = newFormat.alignment();
+    return updateCellFormat(row, column, [&](OpenXLSX::XLCellFormat& format) {
+        auto alignment = format.alignment(OpenXLSX::XLCreateIfMissing);
         if (horizontal == "left") {
             alignment.setHorizontal(OpenXLSX::XLAlignmentStyle::XLAlignLeft);
         } else if (horizontal == "center") {
@@ -347,9 +280,76 @@ bool ExcelOperator::setCellAlignment(uint32_t row, uint32_t column, const std::s
             alignment.setVertical(OpenXLSX::XLAlignmentStyle::XLAlignBottom);
         }
 
-        newFormat.setApplyAlignment(true);
-        
-        auto newFormatIndex = styles.cellFormats().create(newFormat);
+        format.setApplyAlignment(true);
+    });
+}
+
+bool ExcelOperator::setCellStyle(uint32_t row, uint32_t column, const CellStyleChange& change) {
+    if (!m_isOpen || row < 1 || column < 1) {
+        return false;
+    }
+    if (change.empty()) {
+        return true;
+    }
+
+    try {
+        auto cell = currentSheet().cell(row, column);
+        auto key = std::make_pair(cell.cellFormat(), change);
+        auto styled = m_styledFormats.find(key);
+        if (styled == m_styledFormats.end()) {
+            auto& styles = m_document.styles();
+            auto& cellFormats = styles.cellFormats();
+            auto newFormatIndex = cellFormats.findOrCreate(cellFormats[key.first], [&](OpenXLSX::XLCellFormat& format) {
+                if (change.horizontalAlignment) {
+                    format.alignment(OpenXLSX::XLCreateIfMissing).setHorizontal(*change.horizontalAlignment);
+                    format.setApplyAlignment(true);
+                }
+                if (change.changesFont()) {
+                    auto& fonts = styles.fonts();
+                    format.setFontIndex(fonts.findOrCreate(fonts[format.fontIndex()], [&](OpenXLSX::XLFont& font) {
+                        if (change.bold) {
+                            font.setBold(*change.bold);
+                        }
+                        if (change.italic) {
+                            font.setItalic(*change.italic);
+                        }
+                        if (change.underline) {
+                            font.setUnderline(*change.underline ? OpenXLSX::XLUnderlineSingle : OpenXLSX::XLUnderlineNone);
+                        }
+                        if (change.fontColor) {
+                            font.setFontColor(*change.fontColor);
+                        }
+                    }));
+                }
+                if (change.backgroundColor) {
+                    auto& fills = styles.fills();
+                    format.setFillIndex(fills.findOrCreate(fills[format.fillIndex()], [&](OpenXLSX::XLFill& fill) {
+                        fill.setBackgroundColor(*change.backgroundColor);
+                    }));
+                }
+            });
+            styled = m_styledFormats.emplace(std::move(key), newFormatIndex).first;
+        }
+        cell.setCellFormat(styled->second);
+        return true;
+    } catch (const std::exception& e) {
+        return false;
+    }
+}
+
+// The cell's current format (and font / fill) is never modified in place, since other cells may share it.
+// findOrCreate copies it, applies the change to the copy and returns an existing identical entry if there is one,
+// so styling many cells the same way keeps styles.xml compact.
+bool ExcelOperator::updateCellFormat(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLCellFormat&)>& modify) {
+    if (!m_isOpen || row < 1 || column < 1) {
+        return false;
+    }
+
+    try {
+        auto& cellFormats = m_document.styles().cellFormats();
+        auto cell = currentSheet().cell(row, column);
+
+        auto newFormatIndex = cellFormats.findOrCreate(cellFormats[cell.cellFormat()], modify);
         cell.setCellFormat(newFormatIndex);
         return true;
     } catch (const std::exception& e) {
@@ -357,11 +357,25 @@ bool ExcelOperator::setCellAlignment(uint32_t row, uint32_t column, const std::s
     }
 }
 
+bool ExcelOperator::updateCellFont(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLFont&)>& modify) {
+    return updateCellFormat(row, column, [&](OpenXLSX::XLCellFormat& format) {
+        auto& fonts = m_document.styles().fonts();
+        format.setFontIndex(fonts.findOrCreate(fonts[format.fontIndex()], modify));
+    });
+}
+
+bool ExcelOperator::updateCellFill(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLFill&)>& modify) {
+    return updateCellFormat(row, column, [&](OpenXLSX::XLCellFormat& format) {
+        auto& fills = m_document.styles().fills();
+        format.setFillIndex(fills.findOrCreate(fills[format.fillIndex()], modify));
+    });
+}
+
 bool ExcelOperator::setColumnWidth(uint32_t column, double width) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.column(column).setWidth(width);
+    currentSheet().column(column).setWidth(width);
     return true;
 }
 
@@ -369,7 +383,7 @@ bool ExcelOperator::setRowHeight(uint32_t row, double height) {
     if (!m_isOpen) {
         return false;
     }
-    m_currentSheet.row(row).setHeight(height);
+    currentSheet().row(row).setHeight(height);
     return true;
 }
 
@@ -377,27 +391,96 @@ uint32_t ExcelOperator::columnCount() const {
     if (!m_isOpen) {
         return 0;
     }
-    return m_currentSheet.columnCount();
+    return currentSheet().columnCount();
 }
 
 uint32_t ExcelOperator::rowCount() const {
     if (!m_isOpen) {
         return 0;
     }
-    return m_currentSheet.rowCount();
+    return currentSheet().rowCount();
 }
 
 std::vector<std::vector<OpenXLSX::XLCellValue>> ExcelOperator::getRangeValues(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn) {
+    uint32_t nextRow = 0;
+    return getRangePage(firstRow, firstColumn, lastRow, lastColumn, nextRow);
+}
+
+std::vector<std::vector<OpenXLSX::XLCellValue>> ExcelOperator::getRangePage(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, uint32_t& nextRow) {
     std::vector<std::vector<OpenXLSX::XLCellValue>> rangeData;
+    nextRow = 0;
     if (!m_isOpen || firstRow > lastRow || firstColumn > lastColumn) {
         return rangeData;
     }
+    if (!SheetRange{firstRow, firstColumn, lastRow, lastColumn}.isValid()) {
+        throw OpenXLSX::XLCellAddressError("Range " + std::to_string(firstRow) + ":" + std::to_string(firstColumn) + "-" +
+                                           std::to_string(lastRow) + ":" + std::to_string(lastColumn) +
+                                           " is outside the worksheet");
+    }
+
+    // A sheet that has not been loaded is streamed up to lastRow rather than parsed as a whole
+    if (!m_currentSheetLoaded) {
+        const auto width = static_cast<size_t>(lastColumn - firstColumn + 1);
+        const auto readerLastColumn = static_cast<uint16_t>(std::min<uint32_t>(lastColumn, OpenXLSX::MAX_COLS));
 
+        // Continue from where the previous read stopped if it has not passed firstRow yet
+        std::unique_ptr<StreamPosition> position = std::move(m_streamPosition);
+        if (!position || position->sheetName != m_currentSheetName || position->nextRow > firstRow ||
+            position->lastColumn < readerLastColumn) {
+            position = std::make_unique<StreamPosition>(m_currentSheetName, readerLastColumn,
+                                                        m_workbook.worksheetReader(m_currentSheetName));
+        }
+
+        uint32_t rowToAdd = firstRow;
+        auto addRow = [&](std::vector<OpenXLSX::XLCellValue> rowData) {
+            rowData.resize(width);
+            rangeData.push_back(std::move(rowData));
+            ++rowToAdd;
+        };
+
+        std::vector<OpenXLSX::XLCellValue> values;
+        uint32_t row = position->pendingRow;
+        if (row != 0) {
+            values = std::move(position->pendingValues);
+            position->pendingRow = 0;
+        } else {
+            row = position->reader.nextRow(values, position->lastColumn);
+        }
+        for (; row != 0; row = position->reader.nextRow(values, position->lastColumn)) {
+            if (row > lastRow) {
+                position->pendingRow = row;
+                position->pendingValues = std::move(values);
+                nextRow = row;
+                break;
+            }
+            if (row < firstRow) {
+                continue;
+            }
+            while (rowToAdd < row) {
+                addRow({});
+            }
+            if (values.size() < firstColumn) {
+                values.clear();
+            } else {
+                values.erase(values.begin(), values.begin() + (firstColumn - 1));
+            }
+            addRow(std::move(values));
+        }
+        while (rowToAdd <= lastRow) {
+            addRow({});
+        }
+
+        position->nextRow = lastRow + 1;
+        m_streamPosition = std::move(position);
+        return rangeData;
+    }
+
+    // findCell does not create the cells it is asked for, so reads leave the sheet unmodified
     for (uint32_t r = firstRow; r <= lastRow; ++r) {
         std::vector<OpenXLSX::XLCellValue> rowData;
         for (uint32_t c = firstColumn; c <= lastColumn; ++c) {
-            OpenXLSX::XLCell cell = m_currentSheet.cell(r, c);
-            if (cell) {
+            OpenXLSX::XLCell cell = m_currentSheet.findCell(r, static_cast<uint16_t>(c));
+            if (!cell.empty()) {
                 rowData.push_back(cell.value());
             } else {
                 rowData.push_back(OpenXLSX::XLCellValue());
@@ -405,6 +488,9 @@ std::vector<std::vector<OpenXLSX::XLCellValue>> ExcelOperator::getRangeValues(ui
         }
         rangeData.push_back(rowData);
     }
+    if (lastRow < m_currentSheet.rowCount()) {
+        nextRow = lastRow + 1;
+    }
     return rangeData;
 }
 
@@ -413,13 +499,52 @@ bool ExcelOperator::setRangeValues(uint32_t firstRow, uint32_t firstColumn, cons
         return false;
     }
 
+    // One row lookup and one ordered pass over its cells per row, instead of a cell lookup per value
     for (size_t r = 0; r < values.size(); ++r) {
-        for (size_t c = 0; c < values[r].size(); ++c) {
-            OpenXLSX::XLCellReference cellRef(firstRow + r, firstColumn + c);
-            setCellValue(cellRef.address(), values[r][c]);
+        if (!setRowValues(static_cast<uint32_t>(firstRow + r), firstColumn, values[r])) {
+            return false;
         }
     }
-    this->save();
+    return true;
+}
+
+bool ExcelOperator::setRowValues(uint32_t rowNumber, uint32_t firstColumn, const std::vector<XLCellValue>& values) {
+    if (!m_isOpen || firstColumn < 1 || firstColumn > OpenXLSX::MAX_COLS) {
+        return false;
+    }
+    currentSheet().setRowValues(rowNumber, static_cast<uint16_t>(firstColumn), values);
+    return true;
+}
+
+bool ExcelOperator::writeSheetRows(const std::string& sheetName, const std::vector<std::vector<XLCellValue>>& rows, bool inlineStrings) {
+    if (!m_isOpen) {
+        return false;
+    }
+    if (rows.size() > OpenXLSX::MAX_ROWS) {
+        throw OpenXLSX::XLInputError(std::to_string(rows.size()) + " rows exceed the worksheet rows");
+    }
+    for (const auto& row : rows) {
+        if (row.size() > OpenXLSX::MAX_COLS) {
+            throw OpenXLSX::XLInputError("A row of " + std::to_string(row.size()) + " values exceeds the worksheet columns");
+        }
+    }
+
+    m_streamPosition.reset();
+    if (!m_workbook.worksheetExists(sheetName)) {
+        m_workbook.addWorksheet(sheetName);
+    }
+
+    // Closing the writer unloads the sheet's DOM, so a loaded handle to it must be fetched again
+    if (sheetName == m_currentSheetName) {
+        m_currentSheetLoaded = false;
+    }
+    auto writer = m_workbook.worksheetWriter(sheetName, inlineStrings ? OpenXLSX::XLStringStorage::InlineStrings
+                                                                      : OpenXLSX::XLStringStorage::SharedStrings);
+    // An exception leaves the writer unclosed, so its destructor discards the rows written so far
+    for (const auto& row : rows) {
+        writer.appendRow(row);
+    }
+    writer.close();
     return true;
 }
 
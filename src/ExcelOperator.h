@@ -4,6 +4,11 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <utility>
 
 #include <OpenXLSX.hpp>
 
@@ -11,6 +16,20 @@ using OpenXLSX::XLCellValue;
 
 namespace ExcelWrapper {
 
+// Style changes applied to a cell in one step by ExcelOperator::setCellStyle; unset members are left as they are.
+struct CellStyleChange {
+    std::optional<OpenXLSX::XLAlignmentStyle> horizontalAlignment;
+    std::optional<bool> bold;
+    std::optional<bool> italic;
+    std::optional<bool> underline;
+    std::optional<OpenXLSX::XLColor> fontColor;
+    std::optional<OpenXLSX::XLColor> backgroundColor;
+
+    bool empty() const;
+    bool changesFont() const;
+    bool operator<(const CellStyleChange& other) const;
+};
+
 class ExcelOperator {
 public:
     ExcelOperator();
@@ -22,12 +41,16 @@ public:
     bool saveAs(const std::string& filePath);
     bool close();
 
+    // Archive options (compression level and threads) used by save/saveAs, kept across open/create
+    void setSaveOptions(const OpenXLSX::XLZipSaveOptions& options);
+
     bool selectSheet(const std::string& sheetName);
     bool selectSheet(uint32_t sheetIndex);
     bool addSheet(const std::string& sheetName);
     bool deleteSheet(const std::string& sheetName);
     bool renameSheet(const std::string& oldName, const std::string& newName);
     uint32_t sheetCount() const;
+    std::vector<std::string> sheetNames() const;
     std::string currentSheetName() const;
 
     template<typename T>
@@ -48,6 +71,11 @@ public:
     bool setCellFontUnderline(uint32_t row, uint32_t column, bool underline);
     bool setCellAlignment(uint32_t row, uint32_t column, const std::string& horizontal, const std::string& vertical);
 
+    // Applies all of change at once, creating at most one cell format, font and fill instead of one of each per
+    // property. The resulting format is remembered per (current format, change), so styling many cells alike
+    // looks their formats up once.
+    bool setCellStyle(uint32_t row, uint32_t column, const CellStyleChange& change);
+
     bool setColumnWidth(uint32_t column, double width);
     bool setRowHeight(uint32_t row, double height);
     uint32_t columnCount() const;
@@ -67,13 +95,56 @@ public:
 
     std::vector<std::vector<OpenXLSX::XLCellValue>> getRangeValues(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn);
 
+    // Reads a large range page by page: returns the rows firstRow..lastRow like getRangeValues and sets nextRow to the
+    // first row after lastRow that may hold data, or 0 if there is none. A streamed sheet keeps its reader where the
+    // page ended, so the next page continues from there instead of reading the sheet from the top again.
+    // Throws XLCellAddressError if the range does not lie within a worksheet.
+    std::vector<std::vector<OpenXLSX::XLCellValue>> getRangePage(uint32_t firstRow, uint32_t firstColumn, uint32_t lastRow, uint32_t lastColumn, uint32_t& nextRow);
+
     bool setRangeValues(uint32_t firstRow, uint32_t firstColumn, const std::vector<std::vector<XLCellValue>>& values);
 
+    // Writes values to the cells of row rowNumber from firstColumn on, in one pass over the row.
+    bool setRowValues(uint32_t rowNumber, uint32_t firstColumn, const std::vector<XLCellValue>& values);
+
+    // Replaces all rows of sheetName (created if missing) with rows, starting at row 1. The rows are streamed into
+    // the archive, so the sheet's DOM is never built; other sheet content such as column widths is kept.
+    // Throws OpenXLSX::XLInputError, before anything is changed, if rows do not fit in a worksheet. If writing fails
+    // part-way, the sheet is left as it was.
+    bool writeSheetRows(const std::string& sheetName, const std::vector<std::vector<XLCellValue>>& rows, bool inlineStrings);
+
 private:
+    // Assign the cell a copy of its current format / font / fill, adjusted by modify
+    bool updateCellFormat(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLCellFormat&)>& modify);
+    bool updateCellFont(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLFont&)>& modify);
+    bool updateCellFill(uint32_t row, uint32_t column, const std::function<void(OpenXLSX::XLFill&)>& modify);
+
+    // The current worksheet, loaded on first use. Range reads of a sheet that is not loaded are streamed instead,
+    // so opening a workbook and reading from a large sheet never builds the sheet's DOM.
+    OpenXLSX::XLWorksheet& currentSheet() const;
+
+    // Where the last streamed range read stopped, see getRangePage
+    struct StreamPosition {
+        StreamPosition(const std::string& sheetName, uint16_t lastColumn, OpenXLSX::XLStreamingSheetReader&& reader);
+
+        std::string sheetName;
+        uint16_t lastColumn;                     // Cells to the right of this column were not decoded
+        uint32_t nextRow = 1;                    // Rows before this one have been consumed
+        OpenXLSX::XLStreamingSheetReader reader;
+        uint32_t pendingRow = 0;                 // Row read past the end of the last range, 0 if none
+        std::vector<OpenXLSX::XLCellValue> pendingValues;
+    };
+
     OpenXLSX::XLDocument m_document;
     OpenXLSX::XLWorkbook m_workbook;
-    OpenXLSX::XLWorksheet m_currentSheet;
+    std::string m_currentSheetName;
+    mutable OpenXLSX::XLWorksheet m_currentSheet;
+    mutable bool m_currentSheetLoaded = false;
     bool m_isOpen;
+    // Cell format resulting from applying a CellStyleChange to a cell format, see setCellStyle. Indices are only
+    // valid for m_document, so this is cleared when it is closed.
+    std::map<std::pair<OpenXLSX::XLStyleIndex, CellStyleChange>, OpenXLSX::XLStyleIndex> m_styledFormats;
+    // Streams from the archive of m_document, so it is dropped whenever the archive or the sheet data may change
+    mutable std::unique_ptr<StreamPosition> m_streamPosition;
 };
 
 } // namespace ExcelWrapper
@@ -83,7 +154,7 @@ void ExcelWrapper::ExcelOperator::setCellValue(const std::string& cellReference,
     if (!m_isOpen) {
         return;
     }
-    m_currentSheet.cell(cellReference).value() = value;
+    currentSheet().cell(cellReference).value() = value;
 }
 
 template<typename T>
@@ -91,7 +162,7 @@ T ExcelWrapper::ExcelOperator::getCellValue(const std::string& cellReference) {
     if (!m_isOpen) {
         return T();
     }
-    return m_currentSheet.cell(cellReference).value().get<T>();
+    return currentSheet().cell(cellReference).value().get<T>();
 }
 
 template<typename T>
@@ -100,7 +171,7 @@ bool ExcelWrapper::ExcelOperator::setRowData(uint32_t rowNumber, const std::vect
         return false;
     }
     for (size_t i = 0; i < data.size(); ++i) {
-        m_currentSheet.cell(rowNumber, static_cast<uint16_t>(i + 1)).value() = data[i];
+        currentSheet().cell(rowNumber, static_cast<uint16_t>(i + 1)).value() = data[i];
     }
     return true;
 }
@@ -112,7 +183,7 @@ std::vector<T> ExcelWrapper::ExcelOperator::getRowData(uint32_t rowNumber) {
         return rowData;
     }
     for (uint16_t col = 1; col <= 100; ++col) {
-        OpenXLSX::XLCell cell = m_currentSheet.cell(rowNumber, col);
+        OpenXLSX::XLCell cell = currentSheet().cell(rowNumber, col);
         if (!cell) {
             break;
         }
@@ -130,7 +201,7 @@ void ExcelWrapper::ExcelOperator::setColumnData(uint16_t columnNumber, const std
         return;
     }
     for (size_t i = 0; i < data.size(); ++i) {
-        m_currentSheet.cell(static_cast<uint32_t>(i + 1), columnNumber).value() = data[i];
+        currentSheet().cell(static_cast<uint32_t>(i + 1), columnNumber).value() = data[i];
     }
 }
 
@@ -141,7 +212,7 @@ std::vector<T> ExcelWrapper::ExcelOperator::getColumnData(uint16_t columnNumber)
         return columnData;
     }
     for (uint32_t row = 1; row <= 100; ++row) {
-        OpenXLSX::XLCell cell = m_currentSheet.findCell(row, columnNumber);
+        OpenXLSX::XLCell cell = currentSheet().findCell(row, columnNumber);
         if (!cell) {
             break;
         }
@@ -0,0 +1,112 @@
+#include "RangeRowDecoder.h"
+
+#include <utility>
+
+namespace ExcelWrapper {
+
+RangeRowDecoder::RangeRowDecoder(RowHandler onRow) : m_onRow(std::move(onRow)) {}
+
+bool RangeRowDecoder::decode(const uint8_t* text, size_t size)
+{
+    m_row.clear();
+    m_depth = 0;
+    m_rowCount = 0;
+    m_error = Error::None;
+    return nlohmann::json::sax_parse(text, text + size, this) && m_error == Error::None;
+}
+
+bool RangeRowDecoder::null()
+{
+    return addCell(OpenXLSX::XLCellValue());
+}
+
+bool RangeRowDecoder::boolean(bool value)
+{
+    return addCell(OpenXLSX::XLCellValue(value));
+}
+
+bool RangeRowDecoder::number_integer(number_integer_t value)
+{
+    return addCell(OpenXLSX::XLCellValue(static_cast<int64_t>(value)));
+}
+
+bool RangeRowDecoder::number_unsigned(number_unsigned_t value)
+{
+    return addCell(OpenXLSX::XLCellValue(static_cast<int64_t>(value)));
+}
+
+bool RangeRowDecoder::number_float(number_float_t value, const string_t& /*text*/)
+{
+    return addCell(OpenXLSX::XLCellValue(static_cast<double>(value)));
+}
+
+bool RangeRowDecoder::string(string_t& value)
+{
+    return addCell(OpenXLSX::XLCellValue(std::move(value)));
+}
+
+bool RangeRowDecoder::binary(binary_t& /*value*/)
+{
+    return fail();
+}
+
+bool RangeRowDecoder::start_object(std::size_t /*elements*/)
+{
+    return fail();
+}
+
+bool RangeRowDecoder::key(string_t& /*value*/)
+{
+    return fail();
+}
+
+bool RangeRowDecoder::end_object()
+{
+    return fail();
+}
+
+bool RangeRowDecoder::start_array(std::size_t /*elements*/)
+{
+    if (m_depth == 1) {
+        m_row.clear();
+    }
+    else if (m_depth == 2) {
+        return fail();
+    }
+    ++m_depth;
+    return true;
+}
+
+bool RangeRowDecoder::end_array()
+{
+    if (m_depth == 2) {
+        m_onRow(m_row);
+        ++m_rowCount;
+    }
+    --m_depth;
+    return true;
+}
+
+bool RangeRowDecoder::parse_error(std::size_t /*position*/, const std::string& /*lastToken*/,
+                                  const nlohmann::detail::exception& /*ex*/)
+{
+    m_error = Error::InvalidJson;
+    return false;
+}
+
+bool RangeRowDecoder::addCell(OpenXLSX::XLCellValue&& value)
+{
+    if (m_depth != 2) {
+        return fail();
+    }
+    m_row.push_back(std::move(value));
+    return true;
+}
+
+bool RangeRowDecoder::fail()
+{
+    m_error = m_depth == 0 ? Error::NotArray : m_depth == 1 ? Error::RowNotArray : Error::UnsupportedValue;
+    return false;
+}
+
+} // namespace ExcelWrapper
@@ -0,0 +1,69 @@
+#ifndef RANGE_ROW_DECODER_H
+#define RANGE_ROW_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <OpenXLSX.hpp>
+
+#include "json.hpp"
+
+namespace ExcelWrapper {
+
+// Decodes the JSON text of a 2D array of cell values ([[1,"a",null],...]) with the SAX parser. Each row is handed
+// on as soon as it is complete, so only one row of values is held at a time.
+class RangeRowDecoder : public nlohmann::json_sax<nlohmann::json> {
+public:
+    enum class Error {
+        None,
+        NotArray,         // The text is not an array
+        RowNotArray,      // An element of the outer array is not an array
+        UnsupportedValue, // A cell is an object or an array
+        InvalidJson
+    };
+
+    using RowHandler = std::function<void(const std::vector<OpenXLSX::XLCellValue>& row)>;
+
+    explicit RangeRowDecoder(RowHandler onRow);
+
+    // Decodes text and returns true if all of it was a valid 2D array. On an error the rows before it have already
+    // been handed on.
+    bool decode(const uint8_t* text, size_t size);
+
+    Error error() const { return m_error; }
+    size_t rowCount() const { return m_rowCount; }
+
+    bool null() override;
+    bool boolean(bool value) override;
+    bool number_integer(number_integer_t value) override;
+    bool number_unsigned(number_unsigned_t value) override;
+    bool number_float(number_float_t value, const string_t& text) override;
+    bool string(string_t& value) override;
+    bool binary(binary_t& value) override;
+    bool start_object(std::size_t elements) override;
+    bool key(string_t& value) override;
+    bool end_object() override;
+    bool start_array(std::size_t elements) override;
+    bool end_array() override;
+    bool parse_error(std::size_t position, const std::string& lastToken, const nlohmann::detail::exception& ex) override;
+
+private:
+    // Adds a cell to the current row, or fails if the value is not inside a row
+    bool addCell(OpenXLSX::XLCellValue&& value);
+
+    // The error for a value that is not a cell at the current depth
+    bool fail();
+
+    RowHandler m_onRow;
+    std::vector<OpenXLSX::XLCellValue> m_row;
+    int m_depth = 0; // 1 inside the outer array, 2 inside a row
+    size_t m_rowCount = 0;
+    Error m_error = Error::None;
+};
+
+} // namespace ExcelWrapper
+
+#endif // RANGE_ROW_DECODER_H
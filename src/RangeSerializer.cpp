@@ -0,0 +1,482 @@
+#include "RangeSerializer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+namespace ExcelWrapper {
+
+namespace {
+
+// Fits any int64_t and the shortest round-trip form of any double
+constexpr size_t NUMBER_BUFFER_SIZE = 32;
+
+// Assumed lengths when sizing the output; XLCellValue only hands out copies of its text
+constexpr size_t NUMBER_SIZE_ESTIMATE = 16;
+constexpr size_t STRING_SIZE_ESTIMATE = 16;
+
+template<typename T>
+void appendChars(std::string& out, T value)
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+} // namespace
+
+RangeSerializer::RangeSerializer(std::string unsupportedText, UnsupportedCellHandler onUnsupported)
+    : m_unsupportedText(std::move(unsupportedText)), m_onUnsupported(std::move(onUnsupported)) {}
+
+bool RangeSerializer::parseFormat(const std::string& name, Format& format)
+{
+    static const std::pair<const char*, Format> FORMATS[] = {
+        {"json", Format::Json},         {"csv", Format::Csv},           {"tsv", Format::Tsv},
+        {"markdown", Format::Markdown}, {"columnar", Format::Columnar}, {"auto", Format::Auto},
+    };
+    for (const auto& [formatName, value] : FORMATS) {
+        if (name == formatName) {
+            format = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string RangeSerializer::serialize(Format format, const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const
+{
+    switch (format) {
+        case Format::Json: return rowsToJson(rows);
+        case Format::Cells: return cellsToJson(rows, firstRow, firstColumn);
+        case Format::Csv: return toDelimited(rows, ',');
+        case Format::Tsv: return toDelimited(rows, '\t');
+        case Format::Markdown: return toMarkdown(rows, firstRow, firstColumn);
+        case Format::Columnar: return toColumnar(rows, firstRow, firstColumn);
+        case Format::Auto: break;
+    }
+
+    // Dense ranges favour the plain rows, sparse ones the cell list or the columnar form
+    std::string best = rowsToJson(rows);
+    for (Format candidate : {Format::Cells, Format::Columnar}) {
+        std::string text = serialize(candidate, rows, firstRow, firstColumn);
+        if (text.size() < best.size()) best = std::move(text);
+    }
+    return best;
+}
+
+std::string RangeSerializer::rowsToJson(const Rows& rows) const
+{
+    std::string out;
+    out.reserve(estimateSize(rows, 0));
+    std::string text;
+
+    out += '[';
+    for (size_t r = 0; r < rows.size(); ++r) {
+        if (r > 0) out += ',';
+        out += '[';
+        const auto& row = rows[r];
+        for (size_t c = 0; c < row.size(); ++c) {
+            if (c > 0) out += ',';
+            if (row[c].type() == OpenXLSX::XLValueType::Empty)
+                out += "null";
+            else
+                appendJsonValue(out, row[c], r, c, text);
+        }
+        out += ']';
+    }
+    out += ']';
+    return out;
+}
+
+std::string RangeSerializer::cellsToJson(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const
+{
+    std::string out;
+    out.reserve(estimateSize(rows, 8)); // "@" and the address
+    std::string text;
+    bool first = true;
+
+    out += '[';
+    for (size_t r = 0; r < rows.size(); ++r) {
+        const auto& row = rows[r];
+        for (size_t c = 0; c < row.size(); ++c) {
+            const auto& value = row[c];
+            if (value.type() == OpenXLSX::XLValueType::Empty) continue;
+
+            if (!first) out += ',';
+            first = false;
+
+            switch (value.type()) {
+                case OpenXLSX::XLValueType::Boolean:
+                    out += value.get<bool>() ? "\"TRUE" : "\"FALSE";
+                    break;
+                case OpenXLSX::XLValueType::Integer:
+                    out += '"';
+                    appendChars(out, value.get<int64_t>());
+                    break;
+                case OpenXLSX::XLValueType::Float:
+                    out += '"';
+                    appendChars(out, value.get<double>());
+                    break;
+                default: // String and Error
+                    readString(value, r, c, text);
+                    appendString(out, text);
+                    out.pop_back(); // Reopen the string for the address
+                    break;
+            }
+            out += '@';
+            appendCellAddress(out, firstRow + static_cast<uint32_t>(r), firstColumn + static_cast<uint32_t>(c));
+            out += '"';
+        }
+    }
+    out += ']';
+    return out;
+}
+
+std::string RangeSerializer::toDelimited(const Rows& rows, char separator) const
+{
+    std::string out;
+    out.reserve(estimateSize(rows, 0));
+    std::string text;
+    const std::string quoted = {separator, '"', '\n', '\r'}; // Characters that make a CSV field quoted
+
+    for (size_t r = 0; r < rows.size(); ++r) {
+        const auto& row = rows[r];
+        for (size_t c = 0; c < row.size(); ++c) {
+            if (c > 0) out += separator;
+            readText(row[c], r, c, text);
+
+            if (separator == '\t') {
+                for (char ch : text) {
+                    switch (ch) {
+                        case '\t': out += "\\t"; break;
+                        case '\n': out += "\\n"; break;
+                        case '\r': out += "\\r"; break;
+                        case '\\': out += "\\\\"; break;
+                        default: out += ch; break;
+                    }
+                }
+            }
+            else if (text.find_first_of(quoted) != std::string::npos) {
+                out += '"';
+                for (char ch : text) {
+                    if (ch == '"') out += '"';
+                    out += ch;
+                }
+                out += '"';
+            }
+            else {
+                out += text;
+            }
+        }
+        out += '\n';
+    }
+    return out;
+}
+
+std::string RangeSerializer::toMarkdown(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const
+{
+    size_t columnCount = 0;
+    for (const auto& row : rows) columnCount = std::max(columnCount, row.size());
+
+    std::string out;
+    out.reserve(estimateSize(rows, 2) + (columnCount + 1) * 8 * 2);
+    std::string text;
+
+    out += "| ";
+    for (size_t c = 0; c < columnCount; ++c) {
+        out += " | ";
+        appendColumnLetters(out, firstColumn + static_cast<uint32_t>(c));
+    }
+    out += " |\n|---";
+    for (size_t c = 0; c < columnCount; ++c) out += "|---";
+    out += "|\n";
+
+    for (size_t r = 0; r < rows.size(); ++r) {
+        const auto& row = rows[r];
+        out += "| ";
+        appendChars(out, firstRow + static_cast<uint32_t>(r));
+        for (size_t c = 0; c < columnCount; ++c) {
+            out += " | ";
+            if (c >= row.size()) continue;
+            readText(row[c], r, c, text);
+            for (char ch : text) {
+                switch (ch) {
+                    case '\\': out += "\\\\"; break; // So a trailing backslash can not escape the delimiter after it
+                    case '|': out += "\\|"; break;
+                    case '\n': out += "<br>"; break;
+                    case '\r': break;
+                    default: out += ch; break;
+                }
+            }
+        }
+        out += " |\n";
+    }
+    return out;
+}
+
+std::string RangeSerializer::toColumnar(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const
+{
+    size_t columnCount = 0;
+    for (const auto& row : rows) columnCount = std::max(columnCount, row.size());
+
+    std::string out;
+    out.reserve(estimateSize(rows, 0) + columnCount * 32);
+    std::string text;
+
+    out += "{\"first_row\":";
+    appendChars(out, firstRow);
+    out += ",\"first_column\":";
+    appendChars(out, firstColumn);
+    out += ",\"row_count\":";
+    appendChars(out, rows.size());
+    out += ",\"columns\":[";
+
+    std::vector<std::string> strings;                  // Non-empty string cells of the current column, in row order
+    std::unordered_map<std::string, size_t> dictIndex; // Distinct strings of the current column
+    std::vector<const std::string*> dict;              // Distinct strings in order of first appearance
+
+    for (size_t c = 0; c < columnCount; ++c) {
+        auto cellAt = [&](size_t r) -> const OpenXLSX::XLCellValue* {
+            return c < rows[r].size() && rows[r][c].type() != OpenXLSX::XLValueType::Empty ? &rows[r][c] : nullptr;
+        };
+
+        // Type tag of the column, from the types of its non-empty cells
+        bool hasInt = false, hasFloat = false, hasBool = false, hasString = false;
+        for (size_t r = 0; r < rows.size(); ++r) {
+            const auto* value = cellAt(r);
+            if (!value) continue;
+            switch (value->type()) {
+                case OpenXLSX::XLValueType::Integer: hasInt = true; break;
+                case OpenXLSX::XLValueType::Float: hasFloat = true; break;
+                case OpenXLSX::XLValueType::Boolean: hasBool = true; break;
+                default: hasString = true; break;
+            }
+        }
+        const char* type = "empty";
+        if (hasString) type = (hasInt || hasFloat || hasBool) ? "mixed" : "string";
+        else if (hasBool) type = (hasInt || hasFloat) ? "mixed" : "bool";
+        else if (hasInt && hasFloat) type = "number";
+        else if (hasInt) type = "int";
+        else if (hasFloat) type = "float";
+
+        if (c > 0) out += ',';
+        out += "{\"column\":\"";
+        appendColumnLetters(out, firstColumn + static_cast<uint32_t>(c));
+        out += "\",\"type\":\"";
+        out += type;
+        out += '"';
+        if (std::string_view(type) == "empty") {
+            out += '}';
+            continue;
+        }
+
+        // Runs of empty cells
+        bool firstRun = true;
+        for (size_t r = 0; r < rows.size();) {
+            if (cellAt(r)) {
+                ++r;
+                continue;
+            }
+            const size_t start = r;
+            while (r < rows.size() && !cellAt(r)) ++r;
+            out += firstRun ? ",\"nulls\":[[" : ",[";
+            firstRun = false;
+            appendChars(out, start);
+            out += ',';
+            appendChars(out, r - start);
+            out += ']';
+        }
+        if (!firstRun) out += ']';
+
+        // String columns use a dictionary when the distinct strings plus their indices are shorter than the strings
+        bool useDict = false;
+        if (std::string_view(type) == "string") {
+            strings.clear();
+            dictIndex.clear();
+            dict.clear();
+            size_t plainSize = 0;
+            for (size_t r = 0; r < rows.size(); ++r) {
+                if (!cellAt(r)) continue;
+                readString(*cellAt(r), r, c, text);
+                plainSize += text.size() + 3;
+                strings.push_back(std::move(text));
+            }
+            size_t dictSize = 10; // ,"dict":[]
+            for (const auto& str : strings) {
+                auto [it, inserted] = dictIndex.emplace(str, dict.size());
+                if (inserted) {
+                    dict.push_back(&it->first);
+                    dictSize += str.size() + 3;
+                }
+                dictSize += 2 + (it->second >= 10) + (it->second >= 100) + (it->second >= 1000) + (it->second >= 10000);
+            }
+            useDict = dictSize < plainSize;
+
+            if (useDict) {
+                out += ",\"dict\":[";
+                for (size_t i = 0; i < dict.size(); ++i) {
+                    if (i > 0) out += ',';
+                    appendString(out, *dict[i]);
+                }
+                out += ']';
+            }
+            out += ",\"values\":[";
+            for (size_t i = 0; i < strings.size(); ++i) {
+                if (i > 0) out += ',';
+                if (useDict)
+                    appendChars(out, dictIndex.find(strings[i])->second);
+                else
+                    appendString(out, strings[i]);
+            }
+            out += "]}";
+            continue;
+        }
+
+        out += ",\"values\":[";
+        bool firstValue = true;
+        for (size_t r = 0; r < rows.size(); ++r) {
+            const auto* value = cellAt(r);
+            if (!value) continue;
+            if (!firstValue) out += ',';
+            firstValue = false;
+            appendJsonValue(out, *value, r, c, text);
+        }
+        out += "]}";
+    }
+    out += "]}";
+    return out;
+}
+
+void RangeSerializer::appendString(std::string& out, std::string_view text)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    out += '"';
+    size_t plainStart = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const unsigned char ch = static_cast<unsigned char>(text[i]);
+        if (ch >= 0x20 && ch != '"' && ch != '\\') continue;
+
+        out.append(text.data() + plainStart, i - plainStart);
+        plainStart = i + 1;
+        switch (ch) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                out += "\\u00";
+                out += HEX_DIGITS[ch >> 4];
+                out += HEX_DIGITS[ch & 0x0f];
+                break;
+        }
+    }
+    out.append(text.data() + plainStart, text.size() - plainStart);
+    out += '"';
+}
+
+void RangeSerializer::appendNumber(std::string& out, double value)
+{
+    if (!std::isfinite(value)) {
+        out += "null";
+        return;
+    }
+    const size_t start = out.size();
+    appendChars(out, value);
+    // Keep floats recognisable as such, e.g. 3.0 rather than 3
+    if (out.find_first_of(".e", start) == std::string::npos) out += ".0";
+}
+
+void RangeSerializer::appendNumber(std::string& out, int64_t value)
+{
+    appendChars(out, value);
+}
+
+void RangeSerializer::appendCellAddress(std::string& out, uint32_t row, uint32_t column)
+{
+    appendColumnLetters(out, column);
+    appendChars(out, row);
+}
+
+void RangeSerializer::appendColumnLetters(std::string& out, uint32_t column)
+{
+    char letters[8];
+    size_t count = 0;
+    while (column > 0 && count < sizeof(letters)) {
+        const uint32_t rem = (column - 1) % 26;
+        letters[count++] = static_cast<char>('A' + rem);
+        column = (column - 1) / 26;
+    }
+    while (count > 0) out += letters[--count];
+}
+
+size_t RangeSerializer::estimateSize(const Rows& rows, size_t perCellExtra)
+{
+    size_t size = 2;
+    for (const auto& row : rows) {
+        size += 3;
+        for (const auto& value : row) {
+            switch (value.type()) {
+                case OpenXLSX::XLValueType::Empty: size += 5; break;
+                case OpenXLSX::XLValueType::Boolean: size += 6 + perCellExtra; break;
+                case OpenXLSX::XLValueType::Integer:
+                case OpenXLSX::XLValueType::Float: size += NUMBER_SIZE_ESTIMATE + perCellExtra; break;
+                default: size += STRING_SIZE_ESTIMATE + 3 + perCellExtra; break;
+            }
+        }
+    }
+    return size;
+}
+
+bool RangeSerializer::readString(const OpenXLSX::XLCellValue& value, size_t rowOffset, size_t columnOffset,
+                                 std::string& text) const
+{
+    try {
+        text = value.get<std::string>();
+        return true;
+    } catch (const OpenXLSX::XLValueTypeError& e) {
+        text = m_unsupportedText;
+        if (m_onUnsupported) m_onUnsupported(rowOffset, columnOffset, e.what());
+        return false;
+    }
+}
+
+void RangeSerializer::readText(const OpenXLSX::XLCellValue& value, size_t rowOffset, size_t columnOffset,
+                               std::string& text) const
+{
+    text.clear();
+    switch (value.type()) {
+        case OpenXLSX::XLValueType::Empty: break;
+        case OpenXLSX::XLValueType::Boolean: text = value.get<bool>() ? "TRUE" : "FALSE"; break;
+        case OpenXLSX::XLValueType::Integer: appendChars(text, value.get<int64_t>()); break;
+        case OpenXLSX::XLValueType::Float: appendChars(text, value.get<double>()); break;
+        default: readString(value, rowOffset, columnOffset, text); break;
+    }
+}
+
+void RangeSerializer::appendJsonValue(std::string& out, const OpenXLSX::XLCellValue& value, size_t rowOffset,
+                                      size_t columnOffset, std::string& text) const
+{
+    switch (value.type()) {
+        case OpenXLSX::XLValueType::Boolean:
+            out += value.get<bool>() ? "true" : "false";
+            break;
+        case OpenXLSX::XLValueType::Integer:
+            appendNumber(out, value.get<int64_t>());
+            break;
+        case OpenXLSX::XLValueType::Float:
+            appendNumber(out, value.get<double>());
+            break;
+        default: // String and Error
+            readString(value, rowOffset, columnOffset, text);
+            appendString(out, text);
+            break;
+    }
+}
+
+} // namespace ExcelWrapper
@@ -0,0 +1,91 @@
+#ifndef RANGE_SERIALIZER_H
+#define RANGE_SERIALIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OpenXLSX.hpp>
+
+namespace ExcelWrapper {
+
+// Writes range values as text straight into one pre-sized string, without building a JSON document first.
+class RangeSerializer {
+public:
+    using Rows = std::vector<std::vector<OpenXLSX::XLCellValue>>;
+
+    enum class Format {
+        Json,     // rowsToJson
+        Cells,    // cellsToJson
+        Csv,      // toDelimited with ','
+        Tsv,      // toDelimited with '\t'
+        Markdown, // toMarkdown
+        Columnar, // toColumnar
+        Auto      // The smallest of Json, Cells and Columnar
+    };
+
+    // Parses a format name ("json", "csv", "tsv", "markdown", "columnar" or "auto"); false if it is unknown.
+    static bool parseFormat(const std::string& name, Format& format);
+
+    // Called for a cell whose value can not be read; offsets are 0-based within the range.
+    using UnsupportedCellHandler = std::function<void(size_t rowOffset, size_t columnOffset, const std::string& error)>;
+
+    // unsupportedText is written in place of a value that can not be read.
+    explicit RangeSerializer(std::string unsupportedText, UnsupportedCellHandler onUnsupported = nullptr);
+
+    // [[1,"a",null],...]: one array per row, empty cells as null.
+    std::string rowsToJson(const Rows& rows) const;
+
+    // ["1@A1","a@B1",...]: the non-empty cells as "value@address", addressed from firstRow/firstColumn.
+    // Booleans are written as TRUE/FALSE.
+    std::string cellsToJson(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const;
+
+    // One line per row. CSV quotes fields as in RFC 4180; TSV escapes tab, newline and backslash as \t, \n and \\.
+    std::string toDelimited(const Rows& rows, char separator) const;
+
+    // A table with the column letters as header and the row number in the first column. Backslash and | in cell text
+    // are escaped as \\ and \|, and line breaks are written as <br>.
+    std::string toMarkdown(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const;
+
+    // {"first_row":1,"first_column":1,"row_count":3,"columns":[{"column":"A","type":"string","dict":["x","y"],
+    // "nulls":[[1,1]],"values":[0,1]},...]}: one entry per column with its type (int, float, number, bool, string,
+    // mixed or empty). values holds the non-empty cells only; nulls lists the empty runs as [rowOffset, count].
+    // Repeated strings are replaced by indices into dict when that is shorter.
+    std::string toColumnar(const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const;
+
+    std::string serialize(Format format, const Rows& rows, uint32_t firstRow, uint32_t firstColumn) const;
+
+    // Appends text as a quoted JSON string.
+    static void appendString(std::string& out, std::string_view text);
+
+    // Appends the shortest representation that round-trips; non-finite values are written as null.
+    static void appendNumber(std::string& out, double value);
+    static void appendNumber(std::string& out, int64_t value);
+
+    // Appends an A1-style address, e.g. AB12, or the column letters alone.
+    static void appendCellAddress(std::string& out, uint32_t row, uint32_t column);
+    static void appendColumnLetters(std::string& out, uint32_t column);
+
+private:
+    // Expected text size for rows, so the output is usually allocated once.
+    static size_t estimateSize(const Rows& rows, size_t perCellExtra);
+
+    bool readString(const OpenXLSX::XLCellValue& value, size_t rowOffset, size_t columnOffset, std::string& text) const;
+
+    // The unquoted text of a cell as written to CSV, TSV and Markdown; empty for an empty cell.
+    void readText(const OpenXLSX::XLCellValue& value, size_t rowOffset, size_t columnOffset, std::string& text) const;
+
+    // Appends a non-empty cell as a JSON scalar.
+    void appendJsonValue(std::string& out, const OpenXLSX::XLCellValue& value, size_t rowOffset, size_t columnOffset,
+                         std::string& text) const;
+
+    std::string m_unsupportedText;
+    UnsupportedCellHandler m_onUnsupported;
+};
+
+} // namespace ExcelWrapper
+
+#endif // RANGE_SERIALIZER_H
@@ -0,0 +1,64 @@
+#include "SheetRange.h"
+
+#include <exception>
+
+#include <OpenXLSX.hpp>
+
+namespace ExcelWrapper {
+
+bool SheetRange::isValid() const
+{
+    return firstRow >= 1 && firstRow <= lastRow && lastRow <= OpenXLSX::MAX_ROWS && firstColumn >= 1 &&
+           firstColumn <= lastColumn && lastColumn <= OpenXLSX::MAX_COLS;
+}
+
+std::string RangeCursor::encode() const
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    const std::string payload = std::to_string(revision) + ":" + std::to_string(nextRow) + ":" + sheetName;
+    std::string encoded;
+    encoded.reserve(payload.size() * 2);
+    for (unsigned char ch : payload) {
+        encoded += HEX_DIGITS[ch >> 4];
+        encoded += HEX_DIGITS[ch & 0x0f];
+    }
+    return encoded;
+}
+
+bool RangeCursor::decode(const std::string& encoded, const std::string& sheetName, const SheetRange& range,
+                         RangeCursor& cursor)
+{
+    if (!range.isValid() || encoded.size() % 2 != 0) return false;
+
+    auto hexValue = [](char ch) -> int {
+        if (ch >= '0' && ch <= '9') return ch - '0';
+        if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+        return -1;
+    };
+    std::string payload;
+    payload.reserve(encoded.size() / 2);
+    for (size_t i = 0; i < encoded.size(); i += 2) {
+        const int high = hexValue(encoded[i]);
+        const int low = hexValue(encoded[i + 1]);
+        if (high < 0 || low < 0) return false;
+        payload += static_cast<char>(high * 16 + low);
+    }
+
+    const size_t firstColon = payload.find(':');
+    const size_t secondColon = firstColon == std::string::npos ? std::string::npos : payload.find(':', firstColon + 1);
+    if (secondColon == std::string::npos) return false;
+    unsigned long nextRow = 0;
+    try {
+        cursor.revision = std::stoull(payload.substr(0, firstColon));
+        nextRow = std::stoul(payload.substr(firstColon + 1, secondColon - firstColon - 1));
+    } catch (const std::exception&) {
+        return false;
+    }
+    // Checked before narrowing, so a row past the worksheet can not wrap around into it
+    if (nextRow < 1 || nextRow > OpenXLSX::MAX_ROWS) return false;
+    cursor.nextRow = static_cast<uint32_t>(nextRow);
+    cursor.sheetName = payload.substr(secondColon + 1);
+    return cursor.sheetName == sheetName && cursor.nextRow >= range.firstRow && cursor.nextRow <= range.lastRow;
+}
+
+} // namespace ExcelWrapper
@@ -0,0 +1,38 @@
+#ifndef SHEET_RANGE_H
+#define SHEET_RANGE_H
+
+#include <cstdint>
+#include <string>
+
+namespace ExcelWrapper {
+
+// A rectangular range of a worksheet, with 1-based, inclusive row and column numbers
+struct SheetRange {
+    uint32_t firstRow = 0;
+    uint32_t firstColumn = 0;
+    uint32_t lastRow = 0;
+    uint32_t lastColumn = 0;
+
+    // True if the range is not empty and lies within a worksheet, i.e. ends at MAX_ROWS and MAX_COLS at the latest.
+    // Tool calls check their range with it before leasing the workbook, as reads size their result by the range.
+    bool isValid() const;
+};
+
+// Position of the next page of a paged range read. It is handed to the client as an opaque hex string and only
+// valid for the workbook revision it was issued for.
+struct RangeCursor {
+    uint64_t revision = 0;
+    uint32_t nextRow = 0;
+    std::string sheetName;
+
+    std::string encode() const;
+
+    // Decodes a cursor passed back with a read of range on sheetName. Returns false if encoded is malformed, if range
+    // is not valid, or if the cursor was issued for another sheet or points at a row outside range.
+    static bool decode(const std::string& encoded, const std::string& sheetName, const SheetRange& range,
+                       RangeCursor& cursor);
+};
+
+} // namespace ExcelWrapper
+
+#endif // SHEET_RANGE_H
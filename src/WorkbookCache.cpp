@@ -0,0 +1,416 @@
+#include "WorkbookCache.h"
+
+#include <algorithm>
+#include <system_error>
+#include <vector>
+
+#include "mcp_metrics.h"
+#include "spdlog/spdlog.h"
+
+namespace ExcelWrapper {
+
+namespace {
+
+// Looked up once, when the cache is constructed, so recording never takes the registry lock
+struct CacheMetrics {
+    mcp::metric_counter& hits;
+    mcp::metric_counter& misses;  // Not resident, or evicted since it was last used
+    mcp::metric_counter& reloads; // Resident, but changed on disk
+    mcp::metric_counter& evictions;
+    mcp::latency_histogram& loadTime;
+    mcp::latency_histogram& saveTime;
+};
+
+CacheMetrics& cacheMetrics() {
+    static CacheMetrics metrics = [] {
+        mcp::metrics& registry = mcp::metrics::instance();
+        registry.describe("excel_workbook_cache_lookups_total", "Workbook cache lookups by tool calls");
+        registry.describe("excel_workbook_cache_evictions_total", "Workbooks evicted from the cache");
+        registry.describe("excel_workbook_load_seconds", "Time spent opening workbooks, including parsing their XML");
+        registry.describe("excel_workbook_save_seconds", "Time spent saving workbooks");
+        return CacheMetrics{
+            registry.counter("excel_workbook_cache_lookups_total", mcp::metrics::labels({{"result", "hit"}})),
+            registry.counter("excel_workbook_cache_lookups_total", mcp::metrics::labels({{"result", "miss"}})),
+            registry.counter("excel_workbook_cache_lookups_total", mcp::metrics::labels({{"result", "reload"}})),
+            registry.counter("excel_workbook_cache_evictions_total"),
+            registry.histogram("excel_workbook_load_seconds"),
+            registry.histogram("excel_workbook_save_seconds")};
+    }();
+    return metrics;
+}
+
+} // namespace
+
+WorkbookCache::Lease::Lease(WorkbookCache& cache, std::shared_ptr<CachedWorkbook> entry)
+    : m_cache(&cache), m_entry(std::move(entry)), m_lock(m_entry->mutex) {
+}
+
+void WorkbookCache::Lease::markDirty() {
+    m_entry->dirty = true;
+    m_entry->revision = nextRevision();
+    m_cache->scheduleFlush(m_entry->path);
+}
+
+WorkbookCache& WorkbookCache::getInstance() {
+    static WorkbookCache instance;
+    return instance;
+}
+
+WorkbookCache::WorkbookCache() {
+    // The gauges take m_mutex while the registry is locked for reading, so nothing may look up a metric while
+    // holding m_mutex: all of them are looked up here.
+    cacheMetrics();
+    mcp::metrics& registry = mcp::metrics::instance();
+    registry.describe("excel_workbook_cache_resident", "Workbooks resident in the cache");
+    registry.describe("excel_workbook_cache_resident_bytes", "Summed on-disk size of the resident workbooks");
+    registry.gauge("excel_workbook_cache_resident", "", [this] {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return static_cast<double>(m_entries.size());
+    });
+    registry.gauge("excel_workbook_cache_resident_bytes", "", [this] {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::uintmax_t resident = 0;
+        for (const auto& [key, slot] : m_entries) {
+            resident += slot.entry->fileSize;
+        }
+        return static_cast<double>(resident);
+    });
+
+    m_flusher = std::thread([this] { flusherLoop(); });
+}
+
+// Runs during static destruction, when the logger may be gone, so pending edits are saved by shutdown() instead
+WorkbookCache::~WorkbookCache() {
+    stopFlusher();
+}
+
+void WorkbookCache::stopFlusher() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_flushCv.notify_all();
+    if (m_flusher.joinable()) {
+        m_flusher.join();
+    }
+}
+
+void WorkbookCache::shutdown() {
+    stopFlusher();
+    flushAll();
+}
+
+void WorkbookCache::setOptions(const Options& options) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_options = options;
+}
+
+uint64_t WorkbookCache::nextRevision() {
+    // Unique across entries, so a revision is never reused by a workbook that was evicted and loaded again
+    static std::atomic<uint64_t> revision{0};
+    return ++revision;
+}
+
+std::string WorkbookCache::normalizePath(const std::string& filePath) {
+    std::error_code ec;
+    auto absolutePath = std::filesystem::absolute(filePath, ec);
+    if (ec) {
+        return filePath;
+    }
+    return absolutePath.lexically_normal().string();
+}
+
+bool WorkbookCache::statFile(const std::string& filePath, std::filesystem::file_time_type& mtime, std::uintmax_t& size) {
+    std::error_code ec;
+    mtime = std::filesystem::last_write_time(filePath, ec);
+    if (ec) {
+        return false;
+    }
+    size = std::filesystem::file_size(filePath, ec);
+    return !ec;
+}
+
+WorkbookCache::Lease WorkbookCache::acquire(const std::string& filePath) {
+    const std::string key = normalizePath(filePath);
+    EntryPtr entry;
+    std::vector<Victim> victims;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            entry = insertLocked(key);
+        } else {
+            entry = it->second.entry;
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruPos);
+        }
+        victims = selectVictimsLocked(key);
+    }
+    evict(victims);
+
+    Lease lease(*this, entry);
+    try {
+        if (!entry->loaded) {
+            cacheMetrics().misses.add();
+            loadEntry(*entry);
+        } else {
+            std::filesystem::file_time_type mtime;
+            std::uintmax_t size = 0;
+            if (statFile(key, mtime, size) && (mtime != entry->mtime || size != entry->fileSize)) {
+                if (entry->dirty) {
+                    cacheMetrics().hits.add();
+                    spdlog::warn("cache: '{}' changed on disk while it has unsaved edits; keeping the in-memory copy.", key);
+                } else {
+                    cacheMetrics().reloads.add();
+                    spdlog::info("cache: '{}' changed on disk, reloading.", key);
+                    loadEntry(*entry);
+                }
+            } else {
+                cacheMetrics().hits.add();
+            }
+        }
+    } catch (...) {
+        eraseEntry(key, entry);
+        throw;
+    }
+    return lease;
+}
+
+WorkbookCache::Lease WorkbookCache::create(const std::string& filePath) {
+    const std::string key = normalizePath(filePath);
+    EntryPtr entry;
+    std::vector<Victim> victims;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // The file is being replaced, so unsaved edits of a previous resident copy are dropped
+        auto it = m_entries.find(key);
+        if (it != m_entries.end()) {
+            m_lru.erase(it->second.lruPos);
+            m_entries.erase(it);
+            m_flushDeadlines.erase(key);
+        }
+        entry = insertLocked(key);
+        victims = selectVictimsLocked(key);
+    }
+    evict(victims);
+
+    Lease lease(*this, entry);
+    try {
+        entry->loaded = false;
+        entry->excel.create(key);
+        entry->revision = nextRevision();
+        std::uintmax_t size = 0;
+        statFile(key, entry->mtime, size);
+        entry->fileSize = size;
+        entry->loaded = true;
+        entry->dirty = false;
+    } catch (...) {
+        eraseEntry(key, entry);
+        throw;
+    }
+    return lease;
+}
+
+void WorkbookCache::flushAll() {
+    std::vector<EntryPtr> entries;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entries.reserve(m_entries.size());
+        for (const auto& [key, slot] : m_entries) {
+            entries.push_back(slot.entry);
+        }
+        m_flushDeadlines.clear();
+    }
+    for (const auto& entry : entries) {
+        std::lock_guard<std::mutex> lock(entry->mutex);
+        flushOrRetry(*entry);
+    }
+}
+
+WorkbookCache::EntryPtr WorkbookCache::insertLocked(const std::string& key) {
+    auto entry = std::make_shared<CachedWorkbook>();
+    entry->path = key;
+    entry->excel.setSaveOptions(m_options.saveOptions);
+    m_lru.push_front(key);
+    m_entries[key] = Slot{entry, m_lru.begin()};
+    return entry;
+}
+
+std::vector<WorkbookCache::Victim> WorkbookCache::selectVictimsLocked(const std::string& keep) {
+    std::uintmax_t resident = 0;
+    for (const auto& [key, slot] : m_entries) {
+        resident += slot.entry->fileSize;
+    }
+    size_t count = m_entries.size();
+
+    std::vector<Victim> victims;
+    for (auto it = m_lru.rbegin(); it != m_lru.rend(); ++it) {
+        if (count <= m_options.maxWorkbooks && resident <= m_options.memoryBudget) {
+            break;
+        }
+        if (*it == keep) {
+            continue;
+        }
+        EntryPtr entry = m_entries.at(*it).entry;
+        // Workbooks leased by a running tool call (or being flushed) stay resident. An entry referenced only by
+        // the map and by entry cannot be locked by anyone else, so taking its mutex here cannot deadlock.
+        if (entry.use_count() > 2) {
+            continue;
+        }
+        std::unique_lock<std::mutex> entryLock(entry->mutex);
+        // Edits that could not be saved would be lost on eviction; the workbook stays until a retry saves them
+        if (entry->dirty && entry->failedSaves > 0) {
+            continue;
+        }
+        resident -= entry->fileSize;
+        --count;
+        victims.push_back(Victim{entry, std::move(entryLock)});
+    }
+    return victims;
+}
+
+void WorkbookCache::evict(std::vector<Victim>& victims) {
+    // Saving can take a while, so it runs without m_mutex and only blocks callers of the victims themselves.
+    // A victim acquired meanwhile waits for its mutex and then reloads it, because it is no longer loaded.
+    for (auto& victim : victims) {
+        if (!flushEntry(*victim.entry)) {
+            // Keeps the workbook loaded, so the loop below skips it and the cache is over capacity until it is saved
+            spdlog::warn("cache: keeping '{}' resident, as its edits could not be saved", victim.entry->path);
+            scheduleFlush(victim.entry->path, victim.entry->failedSaves);
+            victim.lock.unlock();
+            continue;
+        }
+        victim.entry->excel.close();
+        victim.entry->loaded = false;
+        victim.lock.unlock();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& victim : victims) {
+        const std::string& key = victim.entry->path;
+        auto it = m_entries.find(key);
+        // Referenced by the map and victim only, so nobody can be using it; skip it if it was reloaded meanwhile
+        if (it == m_entries.end() || it->second.entry != victim.entry || victim.entry.use_count() > 2) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> entryLock(victim.entry->mutex);
+            if (victim.entry->loaded) {
+                continue;
+            }
+        }
+        spdlog::info("cache: evicted '{}'", key);
+        cacheMetrics().evictions.add();
+        m_lru.erase(it->second.lruPos);
+        m_flushDeadlines.erase(key);
+        m_entries.erase(it);
+    }
+    victims.clear();
+}
+
+void WorkbookCache::eraseEntry(const std::string& key, const EntryPtr& entry) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end() && it->second.entry == entry) {
+        m_lru.erase(it->second.lruPos);
+        m_entries.erase(it);
+        m_flushDeadlines.erase(key);
+    }
+}
+
+void WorkbookCache::scheduleFlush(const std::string& key, unsigned failedSaves) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Backs off exponentially after failed saves, up to 64 times the flush delay
+        const auto delay = m_options.flushDelay * (1u << std::min(failedSaves, 6u));
+        m_flushDeadlines[key] = Clock::now() + delay;
+    }
+    m_flushCv.notify_one();
+}
+
+void WorkbookCache::loadEntry(CachedWorkbook& entry) {
+    entry.loaded = false;
+    entry.dirty = false;
+    entry.excel.close();
+
+    std::vector<std::string> sheetNames;
+    {
+        mcp::scoped_timer timer(cacheMetrics().loadTime);
+        entry.excel.open(entry.path, sheetNames);
+    }
+    entry.revision = nextRevision();
+
+    std::uintmax_t size = 0;
+    statFile(entry.path, entry.mtime, size);
+    entry.fileSize = size;
+    entry.loaded = true;
+}
+
+bool WorkbookCache::flushEntry(CachedWorkbook& entry) {
+    if (!entry.loaded || !entry.dirty) {
+        return true;
+    }
+    try {
+        mcp::scoped_timer timer(cacheMetrics().saveTime);
+        entry.excel.save();
+        timer.stop();
+        std::uintmax_t size = 0;
+        statFile(entry.path, entry.mtime, size);
+        entry.fileSize = size;
+        entry.dirty = false;
+        entry.failedSaves = 0;
+        return true;
+    } catch (const std::exception& e) {
+        ++entry.failedSaves;
+        spdlog::error("cache: failed to save '{}' (attempt {}), keeping its edits: {}", entry.path, entry.failedSaves, e.what());
+        return false;
+    }
+}
+
+void WorkbookCache::flushOrRetry(CachedWorkbook& entry) {
+    if (!flushEntry(entry)) {
+        scheduleFlush(entry.path, entry.failedSaves);
+    }
+}
+
+void WorkbookCache::flusherLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop) {
+        if (m_flushDeadlines.empty()) {
+            m_flushCv.wait(lock);
+            continue;
+        }
+
+        auto next = Clock::time_point::max();
+        for (const auto& [key, deadline] : m_flushDeadlines) {
+            next = std::min(next, deadline);
+        }
+        const auto now = Clock::now();
+        if (now < next) {
+            m_flushCv.wait_until(lock, next);
+            continue;
+        }
+
+        std::vector<EntryPtr> due;
+        for (auto it = m_flushDeadlines.begin(); it != m_flushDeadlines.end();) {
+            if (it->second > now) {
+                ++it;
+                continue;
+            }
+            auto slotIt = m_entries.find(it->first);
+            if (slotIt != m_entries.end()) {
+                due.push_back(slotIt->second.entry);
+            }
+            it = m_flushDeadlines.erase(it);
+        }
+
+        lock.unlock();
+        for (const auto& entry : due) {
+            std::lock_guard<std::mutex> entryLock(entry->mutex);
+            flushOrRetry(*entry);
+        }
+        due.clear();
+        lock.lock();
+    }
+}
+
+} // namespace ExcelWrapper
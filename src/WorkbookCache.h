@@ -0,0 +1,138 @@
+#ifndef WORKBOOK_CACHE_H
+#define WORKBOOK_CACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "ExcelOperator.h"
+
+namespace ExcelWrapper {
+
+// A workbook kept resident in memory between tool calls.
+// All fields except fileSize are guarded by mutex.
+struct CachedWorkbook {
+    std::string path;
+    ExcelOperator excel;
+    std::filesystem::file_time_type mtime; // On-disk state the document was loaded from or last saved to
+    std::atomic<std::uintmax_t> fileSize{0};
+    uint64_t revision = 0; // Changes whenever the content may have changed: on load, create and every markDirty
+    bool loaded = false;
+    bool dirty = false;
+    unsigned failedSaves = 0; // Consecutive failed saves of the current edits; each one doubles the wait before a retry
+    std::mutex mutex;
+};
+
+class WorkbookCache {
+public:
+    struct Options {
+        size_t maxWorkbooks = 8;                                // Maximum number of resident workbooks
+        std::uintmax_t memoryBudget = 512ull * 1024 * 1024;     // Budget for the summed on-disk size of resident workbooks
+        std::chrono::milliseconds flushDelay{1000};             // Quiet period after the last write before a dirty workbook is saved
+        OpenXLSX::XLZipSaveOptions saveOptions;                 // Compression level and threads used when saving workbooks
+    };
+
+    // Exclusive access to one resident workbook for the duration of a tool call.
+    class Lease {
+    public:
+        Lease(Lease&&) = default;
+        Lease& operator=(Lease&&) = default;
+
+        ExcelOperator* operator->() const { return &m_entry->excel; }
+        ExcelOperator& operator*() const { return m_entry->excel; }
+        const std::string& path() const { return m_entry->path; }
+        uint64_t revision() const { return m_entry->revision; }
+
+        // Marks the workbook as modified. It is saved once no further write arrives within the flush delay,
+        // or earlier if it is evicted.
+        void markDirty();
+
+    private:
+        friend class WorkbookCache;
+        Lease(WorkbookCache& cache, std::shared_ptr<CachedWorkbook> entry);
+
+        WorkbookCache* m_cache;
+        std::shared_ptr<CachedWorkbook> m_entry;
+        std::unique_lock<std::mutex> m_lock; // Declared last so it is released before m_entry
+    };
+
+    // Returns the workbook for filePath, opening it on a miss or when the file changed on disk.
+    // Throws if the file cannot be opened.
+    Lease acquire(const std::string& filePath);
+
+    // Creates (or overwrites) a workbook at filePath and keeps it resident.
+    Lease create(const std::string& filePath);
+
+    // Saves every dirty workbook immediately. A workbook that fails to save keeps its edits and is retried later.
+    void flushAll();
+
+    // Stops saving in the background and saves every dirty workbook. Called before exiting, while logging still works.
+    void shutdown();
+
+    void setOptions(const Options& options);
+
+    // Gets the singleton instance of the WorkbookCache.
+    static WorkbookCache& getInstance();
+
+private:
+    using EntryPtr = std::shared_ptr<CachedWorkbook>;
+    using Clock = std::chrono::steady_clock;
+
+    struct Slot {
+        EntryPtr entry;
+        std::list<std::string>::iterator lruPos;
+    };
+
+    WorkbookCache();
+    ~WorkbookCache();
+    WorkbookCache(const WorkbookCache&) = delete;
+    WorkbookCache& operator=(const WorkbookCache&) = delete;
+
+    static std::string normalizePath(const std::string& filePath);
+    static uint64_t nextRevision();
+    static bool statFile(const std::string& filePath, std::filesystem::file_time_type& mtime, std::uintmax_t& size);
+
+    // A workbook chosen for eviction, locked so that it is saved and closed before anyone else can use it
+    struct Victim {
+        EntryPtr entry;
+        std::unique_lock<std::mutex> lock;
+    };
+
+    EntryPtr insertLocked(const std::string& key);
+    std::vector<Victim> selectVictimsLocked(const std::string& keep);
+    void evict(std::vector<Victim>& victims);
+    void eraseEntry(const std::string& key, const EntryPtr& entry);
+    void scheduleFlush(const std::string& key, unsigned failedSaves = 0);
+
+    // The caller must hold entry.mutex.
+    static void loadEntry(CachedWorkbook& entry);
+    // Returns false if the save failed; the workbook then stays dirty.
+    static bool flushEntry(CachedWorkbook& entry);
+    // Flushes entry and schedules a retry if saving it failed.
+    void flushOrRetry(CachedWorkbook& entry);
+
+    void stopFlusher();
+    void flusherLoop();
+
+    std::unordered_map<std::string, Slot> m_entries;
+    std::list<std::string> m_lru; // Most recently used first
+    std::unordered_map<std::string, Clock::time_point> m_flushDeadlines;
+    Options m_options;
+    std::mutex m_mutex; // Guards everything above; taken while holding an entry mutex, never the reverse (see selectVictimsLocked)
+    std::condition_variable m_flushCv;
+    bool m_stop = false;
+    std::thread m_flusher;
+};
+
+} // namespace ExcelWrapper
+
+#endif // WORKBOOK_CACHE_H
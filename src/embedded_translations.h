@@ -14,7 +14,8 @@ const char* EN_JSON = R"json(
       "missing_params": {
         "get_range": "Missing required parameters for get_sheet_range_content.",
         "create_xlsx": "Missing 'file_path' parameter for create_xlsx_file.",
-        "set_range": "Missing required parameters for set_sheet_range_content."
+        "set_range": "Missing required parameters for set_sheet_range_content.",
+        "write_rows": "Missing required parameters for write_sheet_rows."
       },
       "failed_select_sheet": "Failed to select sheet: {0}",
       "values_not_2d_array": "'values' parameter must be a 2D array for set_sheet_range_content.",
@@ -26,12 +27,17 @@ const char* EN_JSON = R"json(
       "failed_set_range": "Failed to set sheet range content for sheet: {0}",
       "missing_params.set_cells": "Missing required parameters for set_cells_by_array.",
       "cells_not_array": "'cells' parameter must be an array of strings for set_cells_by_array.",
-      "failed_set_cells_by_array": "Failed to set cells by array for sheet: {0}"
+      "failed_set_cells_by_array": "Failed to set cells by array for sheet: {0}",
+      "failed_write_rows": "Failed to write rows to sheet {0}: {1}",
+      "values_exceed_sheet": "'values' do not fit in sheet {0}: {1}",
+      "invalid_range": "Invalid range for get_sheet_range_content on sheet {0}: {1}",
+      "invalid_format": "Unknown output format for get_sheet_range_content: {0}",
+      "invalid_cursor": "Invalid cursor for get_sheet_range_content.",
+      "cursor_expired": "get_sheet_range_content cursor is out of date, the workbook changed."
     },
     "warn": {
        "unsupported_cell_type": {
-          "get_range": "Unsupported cell type encountered at row {0}, col {1}: {2}",
-          "standard": "Unsupported cell type encountered during standard processing: {0}"
+          "get_range": "Unsupported cell type encountered at row {0}, col {1}: {2}"
        },
        "invalid_cell_address": "Skipping invalid cell address during parsing: {0}"
     },
@@ -41,6 +47,7 @@ const char* EN_JSON = R"json(
       "created_excel": "Successfully created Excel file: {0}",
       "set_range": "Successfully set sheet range content for sheet: {0}",
       "set_cells_by_array": "Successfully set cells by array for sheet: {0}",
+      "write_rows": "Successfully wrote {1} rows to sheet: {0}",
       "setting_cell_style": "Setting style '{1}' for cell '{0}'",
       "server_start": "Starting MCP server at localhost:{0}",
       "server_stop_prompt": "Press Ctrl+C to stop the server",
@@ -58,7 +65,8 @@ const char* EN_JSON = R"json(
       "failed_open_or_list": "Failed to open Excel file or list sheets: {0}",
       "missing_params": {
          "get_range": "Missing required parameters for sheet range content.",
-         "set_range": "Missing required parameters for setting sheet range content."
+         "set_range": "Missing required parameters for setting sheet range content.",
+         "write_rows": "Missing required parameters for writing sheet rows."
       },
       "failed_select_sheet": "Failed to select sheet: {0}",
       "failed_create_excel": "Failed to create Excel file: {0}",
@@ -70,7 +78,13 @@ const char* EN_JSON = R"json(
       "failed_set_range": "Failed to set sheet range content.",
       "missing_params.set_cells": "Missing required parameters for setting cells by array.",
       "cells_not_array": "'cells' parameter must be an array of strings.",
-      "failed_set_cells_by_array": "Failed to set cells by array."
+      "failed_set_cells_by_array": "Failed to set cells by array.",
+      "failed_write_rows": "Failed to write sheet rows: {0}",
+      "values_exceed_sheet": "'values' do not fit in the worksheet, which ends at row {0} and column {1}.",
+      "invalid_range": "Invalid range. Rows and columns start at 1, first_row and first_column must not exceed last_row and last_column, and the worksheet ends at row {0} and column {1}.",
+      "invalid_format": "Unknown output format '{0}'. Use json, csv, tsv, markdown, columnar or auto.",
+      "invalid_cursor": "Invalid cursor. Pass the next_cursor of the previous page together with the same sheet_name and range.",
+      "cursor_expired": "The workbook changed since this cursor was issued. Read again from first_row without a cursor."
     }
   },
   "tool": {
@@ -88,7 +102,10 @@ const char* EN_JSON = R"json(
         "first_column": "The starting column number (1-indexed)",
         "last_row": "The ending row number (1-indexed)",
         "last_column": "The ending column number (1-indexed)",
-        "cell_with_coord": "Output non-empty cells with their respective coordinates, suitable for situations where the output area contains a large number of empty cells"
+        "cell_with_coord": "Output non-empty cells with their respective coordinates, suitable for situations where the output area contains a large number of empty cells",
+        "format": "Output encoding, default json (array of rows, or the coordinate list with cell_with_coord). csv/tsv: one line per row, no header. markdown: table headed by column letters, row numbers in the first column. columnar: object whose columns array has one entry per column with its letter, type and values; values holds the non-empty cells only, nulls lists the empty runs as [row offset, count], and if dict is present the values are indices into it. auto: the shortest of json, the coordinate list and columnar, best for large or sparse ranges",
+        "page_rows": "Read the range in pages of at most this many rows (up to 10000). A second text item then reports the page's first_row and last_row and a next_cursor, which is null after the last page",
+        "cursor": "next_cursor of the previous page, to read the next page. Pass the same sheet_name and range as before"
       }
     },
     "set_range": {
@@ -112,14 +129,22 @@ const char* EN_JSON = R"json(
         "sheet_name": "The name of the sheet to write to",
         "cells": "An array of strings, where each string describes the modifications for a cell. Format example: \"'New Content'@A1#BI$FFFFFF%000000\""
       }
+    },
+    "write_rows": {
+      "description": "Replace all rows of a sheet with the given values, starting at row 1. The sheet is created if it does not exist. Meant for generating large sheets: the rows are streamed into the file without building the sheet in memory, and existing cell styles of the sheet are not kept.",
+      "param": {
+        "sheet_name": "The name of the sheet to write to",
+        "values": "The 2D array of row values, the first row is written to row 1",
+        "inline_strings": "Store strings inside the sheet instead of the shared string table. Faster for mostly unique strings"
+      }
     }
   },
   "result": {
     "created_excel": "Excel file created successfully: {0}",
     "set_range": "Successfully set sheet range content.",
     "set_cells_by_array": "Successfully set cells by array.",
-    "unsupported_type": "[Unsupported Type]",
-    "invalid_address": "InvalidAddress"
+    "write_rows": "Successfully wrote {0} rows.",
+    "unsupported_type": "[Unsupported Type]"
   }
 }
 )json";
@@ -1,11 +1,72 @@
 #include "i18n.h"
+#include <deque>
 #include <fstream>
 #include <sstream>
-#include <iostream> // For std::cerr in case spdlog is not yet initialized
+#include "json.hpp"
 #include "spdlog/spdlog.h" // For logging errors
 
 namespace i18n {
 
+// A language flattened at load time: "errors.file_not_found" -> text, with the placeholders of each text located
+// once. A table is never modified after it is built.
+struct I18nManager::Table {
+    struct Placeholder {
+        size_t begin; // Position of the "{n}" text
+        size_t size;
+        size_t index; // n
+    };
+
+    struct Entry {
+        std::string text;
+        std::vector<Placeholder> placeholders;
+    };
+
+    std::string langCode;
+    std::deque<std::string> keys; // Storage for the keys of entries
+    std::unordered_map<std::string_view, Entry> entries;
+
+    void add(const std::string& prefix, const nlohmann::json& data);
+
+    static std::vector<Placeholder> findPlaceholders(const std::string& text);
+};
+
+std::vector<I18nManager::Table::Placeholder> I18nManager::Table::findPlaceholders(const std::string& text) {
+    std::vector<Placeholder> placeholders;
+    for (size_t open = text.find('{'); open != std::string::npos; open = text.find('{', open + 1)) {
+        size_t close = open + 1;
+        size_t index = 0;
+        while (close < text.size() && text[close] >= '0' && text[close] <= '9') {
+            index = index * 10 + static_cast<size_t>(text[close] - '0');
+            ++close;
+        }
+        if (close > open + 1 && close < text.size() && text[close] == '}') {
+            placeholders.push_back({open, close + 1 - open, index});
+        }
+    }
+    return placeholders;
+}
+
+// Nested objects become dotted keys; values that are not strings are skipped, as they can not be translations.
+void I18nManager::Table::add(const std::string& prefix, const nlohmann::json& data) {
+    for (const auto& [name, value] : data.items()) {
+        std::string key = prefix.empty() ? name : prefix + "." + name;
+        if (value.is_object()) {
+            add(key, value);
+        } else if (value.is_string()) {
+            Entry entry;
+            entry.text = value.get<std::string>();
+            entry.placeholders = findPlaceholders(entry.text);
+            entries.erase(key);
+            entries.emplace(keys.emplace_back(std::move(key)), std::move(entry));
+        } else {
+            spdlog::warn("i18n: Translation key '{}' in language '{}' is not a string.", key, langCode);
+        }
+    }
+}
+
+I18nManager::I18nManager() = default;
+I18nManager::~I18nManager() = default;
+
 // Initialize the singleton instance
 I18nManager& I18nManager::getInstance() {
     static I18nManager instance;
@@ -17,108 +78,115 @@ bool I18nManager::loadLanguage(const std::string& langCode, const std::string& f
     std::ifstream fileStream(filePath);
     if (!fileStream.is_open()) {
         spdlog::error("i18n: Failed to open language file: {}", filePath);
-        // Fallback to cerr if spdlog might not be ready
-        // std::cerr << "i18n: Failed to open language file: " << filePath << std::endl;
-        return false;
-    }
-
-    try {
-        nlohmann::json langData = nlohmann::json::parse(fileStream);
-        languages_[langCode] = langData;
-        spdlog::info("i18n: Successfully loaded language file '{}' for language code '{}'", filePath, langCode);
-        // Set the first loaded language as the default/current one if none is set
-        if (currentLangCode_.empty()) {
-            setLanguage(langCode);
-        }
-        return true;
-    } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("i18n: Failed to parse language file '{}': {}", filePath, e.what());
-        // std::cerr << "i18n: Failed to parse language file '" << filePath << "': " << e.what() << std::endl;
-        return false;
-    } catch (const std::exception& e) {
-        spdlog::error("i18n: An unexpected error occurred while loading language file '{}': {}", filePath, e.what());
-        // std::cerr << "i18n: An unexpected error occurred while loading language file '" << filePath << "': " << e.what() << std::endl;
         return false;
     }
+    std::stringstream content;
+    content << fileStream.rdbuf();
+    return addLanguage(langCode, content.str(), "file '" + filePath + "'");
 }
 
 // Load language data from a JSON string
 bool I18nManager::loadLanguageFromString(const std::string& langCode, const std::string& jsonContent) {
+    return addLanguage(langCode, jsonContent, "string");
+}
+
+bool I18nManager::addLanguage(const std::string& langCode, const std::string& jsonContent, const std::string& source) {
+    auto table = std::make_unique<Table>();
+    table->langCode = langCode;
     try {
-        nlohmann::json langData = nlohmann::json::parse(jsonContent);
-        languages_[langCode] = langData;
-        spdlog::info("i18n: Successfully loaded language string for language code '{}'", langCode);
-        // Set the first loaded language as the default/current one if none is set
-        if (currentLangCode_.empty()) {
-            setLanguage(langCode);
-        }
-        return true;
+        table->add("", nlohmann::json::parse(jsonContent));
     } catch (const nlohmann::json::parse_error& e) {
-        spdlog::error("i18n: Failed to parse language string for code '{}': {}", langCode, e.what());
+        spdlog::error("i18n: Failed to parse language {} for code '{}': {}", source, langCode, e.what());
         return false;
     } catch (const std::exception& e) {
-        spdlog::error("i18n: An unexpected error occurred while loading language string for code '{}': {}", langCode, e.what());
+        spdlog::error("i18n: An unexpected error occurred while loading language {} for code '{}': {}", source, langCode, e.what());
         return false;
     }
-}
+    spdlog::info("i18n: Successfully loaded language {} for language code '{}' ({} keys)", source, langCode, table->entries.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slot = languages_[langCode];
+    const Table* current = current_.load(std::memory_order_acquire);
+    if (slot) {
+        // A reader may still be using the replaced table
+        if (current == slot.get()) {
+            current_.store(table.get(), std::memory_order_release);
+        }
+        retired_.push_back(std::move(slot));
+    }
+    slot = std::move(table);
 
+    // Set the first loaded language as the default/current one if none is set
+    if (!current) {
+        current_.store(slot.get(), std::memory_order_release);
+        spdlog::info("i18n: Set current language to '{}'", langCode);
+    }
+    return true;
+}
 
 // Set the current language
 bool I18nManager::setLanguage(const std::string& langCode) {
-    if (languages_.count(langCode)) {
-        currentLangCode_ = langCode;
-        spdlog::info("i18n: Set current language to '{}'", langCode);
-        return true;
-    } else {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = languages_.find(langCode);
+    if (it == languages_.end()) {
         spdlog::warn("i18n: Attempted to set language to '{}', but it was not loaded.", langCode);
         return false;
     }
+    current_.store(it->second.get(), std::memory_order_release);
+    spdlog::info("i18n: Set current language to '{}'", langCode);
+    return true;
 }
 
 // Get the translation for a key
-std::string I18nManager::get(const std::string& key) const {
-    if (currentLangCode_.empty() || languages_.find(currentLangCode_) == languages_.end()) {
-        spdlog::warn("i18n: No language set or current language '{}' not loaded. Returning key '{}'.", currentLangCode_, key);
-        return key; // Return the key itself if no language is set or loaded
+std::string I18nManager::get(std::string_view key) const {
+    return format(key, nullptr, 0);
+}
+
+std::string I18nManager::format(std::string_view key, const detail::FormatArg* args, size_t argCount) const {
+    const Table* table = current_.load(std::memory_order_acquire);
+    if (!table) {
+        spdlog::warn("i18n: No language set. Returning key '{}'.", key);
+        return std::string(key); // Return the key itself if no language is set or loaded
     }
 
-    const auto& langData = languages_.at(currentLangCode_);
-    try {
-        // Navigate nested keys if necessary (e.g., "errors.file_not_found")
-        nlohmann::json current = langData;
-        std::string segment;
-        std::stringstream ss(key);
-        bool first = true;
-        while (std::getline(ss, segment, '.')) {
-            if (!current.contains(segment)) {
-                 spdlog::warn("i18n: Translation key '{}' not found in language '{}'.", key, currentLangCode_);
-                 return key; // Return the original key if not found
-            }
-            current = current[segment];
-            first = false;
-        }
+    auto it = table->entries.find(key);
+    if (it == table->entries.end()) {
+        spdlog::warn("i18n: Translation key '{}' not found in language '{}'.", key, table->langCode);
+        return std::string(key); // Return the original key if not found
+    }
 
+    const Table::Entry& entry = it->second;
+    if (argCount == 0 || entry.placeholders.empty()) {
+        return entry.text;
+    }
 
-        if (current.is_string()) {
-            return current.get<std::string>();
-        } else {
-             spdlog::warn("i18n: Translation key '{}' in language '{}' is not a string.", key, currentLangCode_);
-            return key; // Return key if the found value isn't a string
+    size_t size = entry.text.size();
+    for (const auto& placeholder : entry.placeholders) {
+        if (placeholder.index < argCount) {
+            size += args[placeholder.index].view().size();
         }
-    } catch (const nlohmann::json::exception& e) {
-        spdlog::warn("i18n: Error accessing translation key '{}' in language '{}': {}", key, currentLangCode_, e.what());
-        return key; // Return the key in case of JSON access errors
-    } catch (const std::exception& e) {
-         spdlog::error("i18n: Unexpected error getting translation for key '{}' in language '{}': {}", key, currentLangCode_, e.what());
-         return key;
     }
+
+    std::string result;
+    result.reserve(size);
+    size_t copied = 0;
+    for (const auto& placeholder : entry.placeholders) {
+        if (placeholder.index >= argCount) {
+            continue;
+        }
+        result.append(entry.text, copied, placeholder.begin - copied);
+        result.append(args[placeholder.index].view());
+        copied = placeholder.begin + placeholder.size;
+    }
+    result.append(entry.text, copied, std::string::npos);
+    return result;
 }
 
 // Get the current language code
 const std::string& I18nManager::getCurrentLanguage() const {
-    return currentLangCode_;
+    static const std::string none;
+    const Table* table = current_.load(std::memory_order_acquire);
+    return table ? table->langCode : none;
 }
 
-// Note: The template format functions are defined inline in the header (i18n.h)
-
-} // namespace i18n
\ No newline at end of file
+} // namespace i18n
@@ -1,17 +1,64 @@
 #ifndef I18N_H
 #define I18N_H
 
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
-#include <vector>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
-#include <sstream> // Added for std::stringstream
-#include "json.hpp" // Corrected include path for nlohmann/json
-
-// Use the correct namespace for the JSON library
-namespace nlohmann { using json = basic_json<>; }
+#include <vector>
 
 namespace i18n {
 
+namespace detail {
+
+// An argument of a formatted translation as text. Strings are viewed in place and numbers are written into a
+// local buffer; other types go through a stream. Numbers are written as a stream would write them.
+class FormatArg {
+public:
+    template<typename T>
+    explicit FormatArg(const T& value) {
+        using V = std::decay_t<T>;
+        if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            view_ = value;
+        } else if constexpr (std::is_same_v<V, bool>) {
+            view_ = value ? "1" : "0";
+        } else if constexpr (std::is_same_v<V, char> || std::is_same_v<V, signed char> || std::is_same_v<V, unsigned char>) {
+            buffer_[0] = static_cast<char>(value);
+            view_ = std::string_view(buffer_, 1);
+        } else if constexpr (std::is_integral_v<V>) {
+            auto result = std::to_chars(buffer_, buffer_ + sizeof(buffer_), value);
+            view_ = std::string_view(buffer_, static_cast<size_t>(result.ptr - buffer_));
+        } else if constexpr (std::is_floating_point_v<V>) {
+            int length = std::snprintf(buffer_, sizeof(buffer_), "%g", static_cast<double>(value));
+            view_ = std::string_view(buffer_, length > 0 ? static_cast<size_t>(length) : 0);
+        } else {
+            std::ostringstream ss;
+            ss << value;
+            owned_ = ss.str();
+            view_ = owned_;
+        }
+    }
+
+    // view() may point into this object
+    FormatArg(const FormatArg&) = delete;
+    FormatArg& operator=(const FormatArg&) = delete;
+
+    std::string_view view() const { return view_; }
+
+private:
+    char buffer_[32];
+    std::string owned_;
+    std::string_view view_;
+};
+
+} // namespace detail
+
 class I18nManager {
 public:
     // Loads language data from a JSON file.
@@ -28,14 +75,15 @@ public:
 
     // Gets the translation for a given key in the current language.
     // Returns the key itself if the translation is not found.
-    std::string get(const std::string& key) const;
+    // Lookups read an immutable table and take no lock, so they are safe from any thread.
+    std::string get(std::string_view key) const;
 
     // Gets the translation for a given key and formats it with arguments.
-    // Uses simple placeholder replacement like {0}, {1}, etc.
+    // Every placeholder {n} is replaced by argument n; placeholders without an argument are kept as they are.
     template<typename... Args>
-    std::string get(const std::string& key, Args&&... args) const {
-        std::string formatString = get(key);
-        return format(formatString, std::forward<Args>(args)...);
+    std::string get(std::string_view key, const Args&... args) const {
+        const detail::FormatArg formatArgs[] = {detail::FormatArg(args)...};
+        return format(key, formatArgs, sizeof...(Args));
     }
 
     // Returns the currently set language code.
@@ -45,49 +93,35 @@ public:
     static I18nManager& getInstance();
 
 private:
-    I18nManager() = default; // Private constructor for singleton
-    ~I18nManager() = default;
+    struct Table;
+
+    I18nManager(); // Private constructor for singleton
+    ~I18nManager();
     I18nManager(const I18nManager&) = delete;
     I18nManager& operator=(const I18nManager&) = delete;
 
-    // Helper function for string formatting.
-    template<typename T, typename... Args>
-    std::string format(std::string formatString, T&& value, Args&&... args) const {
-        size_t pos = formatString.find("{" + std::to_string(placeholderIndex++) + "}");
-        if (pos != std::string::npos) {
-            std::stringstream ss;
-            ss << value;
-            formatString.replace(pos, 3 + std::to_string(placeholderIndex - 1).length(), ss.str());
-            return format(formatString, std::forward<Args>(args)...);
-        }
-        // Reset index if we still have arguments but no more placeholders
-        placeholderIndex = 0;
-        return formatString; // Return partially formatted string if placeholders run out
-    }
-
-    // Base case for the recursive format function.
-    std::string format(std::string formatString) const {
-        placeholderIndex = 0; // Reset index for the next call
-        return formatString;
-    }
+    // Adds the flattened language data as langCode, replacing a table loaded before under that code.
+    bool addLanguage(const std::string& langCode, const std::string& jsonContent, const std::string& source);
 
+    std::string format(std::string_view key, const detail::FormatArg* args, size_t argCount) const;
 
-    std::unordered_map<std::string, nlohmann::json> languages_; // Stores loaded language data (langCode -> json object)
-    std::string currentLangCode_;                         // Currently active language code
-    mutable size_t placeholderIndex = 0;                  // Mutable index for formatting placeholders
+    std::mutex mutex_;                                                // Serializes loading and setLanguage
+    std::unordered_map<std::string, std::unique_ptr<const Table>> languages_; // langCode -> table
+    std::vector<std::unique_ptr<const Table>> retired_;              // Replaced tables, kept alive for readers
+    std::atomic<const Table*> current_{nullptr};                     // Table of the current language
 };
 
 // Global convenience function to get translations.
-inline std::string t(const std::string& key) {
+inline std::string t(std::string_view key) {
     return I18nManager::getInstance().get(key);
 }
 
 // Global convenience function to get formatted translations.
 template<typename... Args>
-inline std::string t(const std::string& key, Args&&... args) {
-    return I18nManager::getInstance().get(key, std::forward<Args>(args)...);
+inline std::string t(std::string_view key, const Args&... args) {
+    return I18nManager::getInstance().get(key, args...);
 }
 
 } // namespace i18n
 
-#endif // I18N_H
\ No newline at end of file
+#endif // I18N_H
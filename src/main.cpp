@@ -4,121 +4,176 @@
 // Include the precompiled header last among project headers
 #include "main.h"
 
-#include <algorithm>  // for std::reverse
+#include <csignal>
+#include <cstring>
 #include <filesystem> // Required for path operations
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 using ExcelWrapper::ExcelOperator;
+using ExcelWrapper::WorkbookCache;
 
 static const char DEFAULT_LANG[] = "zh-CN";
 static const int SERVER_PORT = 8888;
 
+// Workbook cache: open documents stay resident between tool calls
+static const size_t CACHE_MAX_WORKBOOKS = 8;
+static const std::uintmax_t CACHE_MEMORY_BUDGET = 512ull * 1024 * 1024; // Summed on-disk size of resident workbooks
+static const std::chrono::milliseconds CACHE_FLUSH_DELAY(1000);        // Debounce before dirty workbooks are saved
+
+// Workbook saving: agents rewrite the same files many times per session, so favour save latency over file size.
+// The level can be overridden by the environment variable.
+static const OpenXLSX::XLCompressionLevel SAVE_COMPRESSION_LEVEL = OpenXLSX::XLCompressionLevel::Fast;
+static const unsigned int SAVE_COMPRESSION_THREADS = 0;                         // 0 = one per hardware thread
+static const char SAVE_COMPRESSION_LEVEL_ENV[] = "EXCELAUTOCPP_SAVE_COMPRESSION"; // store, fast, default or max
+
+// Paged range reads: rows per get_sheet_range_content page when only a cursor is given, and the upper limit
+static const uint32_t RANGE_PAGE_DEFAULT_ROWS = 1000;
+static const uint32_t RANGE_PAGE_MAX_ROWS = 10000;
+
+// Logging: messages are queued for one background thread. When the queue is full the oldest messages are dropped,
+// so a worker never waits for the console. Both settings below can be overridden by the environment variables.
+static const size_t LOG_QUEUE_SIZE = 8192;
+static const std::chrono::milliseconds LOG_FLUSH_INTERVAL(1000);
+static const char LOG_LEVEL_ENV[] = "EXCELAUTOCPP_LOG_LEVEL";       // trace, debug, info, warn, err, critical or off
+static const char LOG_FLUSH_INTERVAL_ENV[] = "EXCELAUTOCPP_LOG_FLUSH_MS";
+
+// Metrics: served in the Prometheus text format over HTTP and as an MCP resource
+static const char METRICS_ENDPOINT[] = "/metrics";
+static const char METRICS_RESOURCE_URI[] = "metrics://prometheus";
+
+// Tracing: the most recent spans, served in the Chrome trace-event format. Only built with -DENABLE_TRACING=ON.
+static const char TRACE_ENDPOINT[] = "/trace";
+
+// Shutdown: Ctrl+C (SIGINT) or SIGTERM stops the server, and the edits still waiting for their flush delay are saved
+static const std::chrono::milliseconds SHUTDOWN_POLL_INTERVAL(100);
+
+// Logs message at level, evaluating it only if the level is enabled; the message is written as is, not as a
+// format string. Used for translated messages, which would otherwise be built even when they are not logged.
+#define LOG_MESSAGE(level, message)                   \
+    do                                                \
+    {                                                 \
+        if (spdlog::should_log(level))                \
+        {                                             \
+            spdlog::log(level, "{}", message);        \
+        }                                             \
+    } while (false)
+
 static const char ASCII_ART[] = "\n\
 ░█▀▀░█░█░█▀▀░█▀▀░█░░░█▀█░█░█░▀█▀░█▀█\n\
 ░█▀▀░▄▀▄░█░░░█▀▀░█░░░█▀█░█░█░░█░░█░█\n\
 ░▀▀▀░▀░▀░▀▀▀░▀▀▀░▀▀▀░▀░▀░▀▀▀░░▀░░▀▀▀\n\
 v0.0.4                 By smileFAace\n";
 
-ExcelOperator g_excel_operator;
-std::string g_current_excel_file_path;
+// Set by s_onStopSignal; main polls it, as a signal handler can do little else safely
+static volatile std::sig_atomic_t g_stop_requested = 0;
 
-// Helper function to convert column number to Excel column letter (e.g., 1 -> A, 27 -> AA)
-static std::string s_colNumberToLetters(uint32_t col_num)
+static void s_onStopSignal(int)
 {
-    std::string col_letters = "";
-    while (col_num > 0)
-    {
-        int rem = col_num % 26;
-        if (rem == 0)
-        {
-            col_letters += 'Z';
-            col_num = (col_num / 26) - 1;
-        }
-        else
-        {
-            col_letters += (rem - 1) + 'A';
-            col_num = col_num / 26;
-        }
-    }
-    // If the original number was 0 or negative, return empty string or handle error
-    if (col_letters.empty() && col_num <= 0)
-    {
-        // Handle error or return a default, e.g., empty string or throw exception
-        // For simplicity, returning empty for column 0 or less. Adjust as needed.
-        return "";
-    }
-    std::reverse(col_letters.begin(), col_letters.end());
-    return col_letters;
+    g_stop_requested = 1;
 }
 
-// Function to get cell address string (e.g., "A1")
-static std::string s_getCellAddress(uint32_t row, uint32_t col)
+// Workbook each session operates on, keyed by session id and set by open_excel_and_list_sheets and
+// create_xlsx_file_by_absolute_path. Sessions working on the same file share its entry in the workbook cache.
+// Entries are dropped when the server closes the session.
+static std::shared_mutex g_session_excel_files_mutex;
+static std::unordered_map<std::string, std::string> g_session_excel_files;
+
+static std::string s_getCurrentExcelFilePath(const std::string &session_id)
 {
-    if (row == 0 || col == 0)
-    {
-        // Handle invalid row/column index, Excel is 1-based
-        return i18n::t("result.invalid_address"); // Or throw an exception
-    }
-    return s_colNumberToLetters(col) + std::to_string(row);
+    std::shared_lock<std::shared_mutex> lock(g_session_excel_files_mutex);
+    auto it = g_session_excel_files.find(session_id);
+    return it != g_session_excel_files.end() ? it->second : std::string();
+}
+
+static void s_setCurrentExcelFilePath(const std::string &session_id, const std::string &file_path)
+{
+    std::unique_lock<std::shared_mutex> lock(g_session_excel_files_mutex);
+    g_session_excel_files[session_id] = file_path;
 }
 
-void ensure_excel_open()
+static void s_clearCurrentExcelFilePath(const std::string &session_id)
 {
-    if (g_current_excel_file_path.empty())
+    std::unique_lock<std::shared_mutex> lock(g_session_excel_files_mutex);
+    g_session_excel_files.erase(session_id);
+}
+
+// Latency of one phase of a tool call, exported as excel_tool_phase_seconds{tool,phase}. Handlers keep the histogram in
+// a function-local static, so it is looked up once.
+static mcp::latency_histogram &s_phaseHistogram(const char *tool, const char *phase)
+{
+    return mcp::metrics::instance().histogram("excel_tool_phase_seconds", mcp::metrics::labels({{"tool", tool}, {"phase", phase}}));
+}
+
+// Leases the session's current workbook. The lease serializes all calls on that file while calls on other files proceed in
+// parallel, so handlers validate their parameters first and keep the lease only while they use the workbook.
+// The time to get the lease, including waiting for other calls and loading the workbook, is recorded in open_time.
+WorkbookCache::Lease ensure_excel_open(const std::string &session_id, mcp::latency_histogram &open_time)
+{
+    const std::string file_path = s_getCurrentExcelFilePath(session_id);
+    if (file_path.empty())
     {
-        spdlog::error(i18n::t("log.error.no_excel_path"));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.no_excel_path"));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.no_excel_path"));
     }
-    std::vector<std::string> dummy_sheet_names; // Only for open function signature
-    if (!g_excel_operator.open(g_current_excel_file_path, dummy_sheet_names))
+    try
+    {
+        MCP_TRACE_SCOPE("excel", "WorkbookCache::acquire");
+        mcp::scoped_timer timer(open_time);
+        return WorkbookCache::getInstance().acquire(file_path);
+    }
+    catch (const std::exception &e)
     {
-        spdlog::error(i18n::t("log.error.failed_open_excel", g_current_excel_file_path));
-        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_open_excel", g_current_excel_file_path));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_open_excel", file_path));
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_open_excel", file_path));
     }
 }
 
-mcp::json open_excel_and_list_sheets_handler(const mcp::json &params, const std::string & /* session_id */)
+mcp::json open_excel_and_list_sheets_handler(const mcp::json &params, const std::string &session_id)
 {
     if (!params.contains("file_path"))
     {
-        spdlog::error(i18n::t("log.error.missing_params.create_xlsx")); // Reusing create_xlsx key as it's just file_path
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.create_xlsx")); // Reusing create_xlsx key as it's just file_path
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_param.file_path"));
     }
 
     std::string file_path = params["file_path"].get<std::string>();
     std::vector<std::string> sheet_names;
 
-    if (g_excel_operator.open(file_path, sheet_names))
+    static mcp::latency_histogram &open_time = s_phaseHistogram("open_excel_and_list_sheets", "open");
+    try
     {
-        g_current_excel_file_path = file_path; // for global file path
-        mcp::json result_sheets = mcp::json::array();
-        for (const auto &name : sheet_names)
-        {
-            result_sheets.push_back(name);
-        }
-        mcp::json result = {
-            {{"type", "text"},
-             {"text", result_sheets.dump()}}};
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.opened_excel", file_path));
-        return result;
+        mcp::scoped_timer timer(open_time);
+        WorkbookCache::Lease excel = WorkbookCache::getInstance().acquire(file_path);
+        timer.stop();
+        sheet_names = excel->sheetNames();
     }
-    else
+    catch (const std::exception &e)
     {
-        spdlog::error(i18n::t("log.error.failed_open_or_list", file_path));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_open_or_list", file_path));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_open_or_list", file_path));
     }
+
+    s_setCurrentExcelFilePath(session_id, file_path);
+    mcp::json result_sheets = mcp::json::array();
+    for (const auto &name : sheet_names)
+    {
+        result_sheets.push_back(name);
+    }
+    mcp::json result = {
+        {{"type", "text"},
+         {"text", result_sheets.dump()}}};
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.opened_excel", file_path));
+    return result;
 }
 
-mcp::json get_sheet_range_content_handler(const mcp::json &params, const std::string & /* session_id */)
+mcp::json get_sheet_range_content_handler(const mcp::json &params, const std::string &session_id)
 {
-    ensure_excel_open();
-
     if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
         !params.contains("last_row") || !params.contains("last_column"))
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.missing_params.get_range"));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.get_range"));
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.get_range"));
     }
 
@@ -129,182 +184,161 @@ mcp::json get_sheet_range_content_handler(const mcp::json &params, const std::st
         seperate_cell = params["cell_with_coord"].get<bool>();
     }
 
+    ExcelWrapper::RangeSerializer::Format format =
+        seperate_cell ? ExcelWrapper::RangeSerializer::Format::Cells : ExcelWrapper::RangeSerializer::Format::Json;
+    if (params.contains("format"))
+    {
+        const std::string format_name = params["format"].get<std::string>();
+        if (format_name != "json" && !ExcelWrapper::RangeSerializer::parseFormat(format_name, format))
+        {
+            LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.invalid_format", format_name));
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.invalid_format", format_name));
+        }
+    }
+
     std::string sheet_name = params["sheet_name"].get<std::string>();
     uint32_t first_row = params["first_row"].get<uint32_t>();
     uint32_t first_column = params["first_column"].get<uint32_t>();
     uint32_t last_row = params["last_row"].get<uint32_t>();
     uint32_t last_column = params["last_column"].get<uint32_t>();
-
-    if (!g_excel_operator.selectSheet(sheet_name))
+    const ExcelWrapper::SheetRange range{first_row, first_column, last_row, last_column};
+    if (!range.isValid())
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_select_sheet", sheet_name));
-        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.invalid_range", sheet_name,
+                                                std::to_string(first_row) + ":" + std::to_string(first_column) + "-" +
+                                                    std::to_string(last_row) + ":" + std::to_string(last_column)));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params,
+                                 i18n::t("exception.error.invalid_range", OpenXLSX::MAX_ROWS, OpenXLSX::MAX_COLS));
     }
 
-    std::vector<std::vector<OpenXLSX::XLCellValue>> range_values =
-        g_excel_operator.getRangeValues(first_row, first_column, last_row, last_column);
-
-    mcp::json result_array = mcp::json::array();
-    if (seperate_cell)
+    // A paged read returns at most page_rows rows, starting at first_row or at the row the cursor points to
+    uint32_t page_rows = 0;
+    if (params.contains("page_rows"))
     {
-        uint32_t current_row = first_row;
-        for (const auto &row : range_values)
+        page_rows = std::min(params["page_rows"].get<uint32_t>(), RANGE_PAGE_MAX_ROWS);
+    }
+    ExcelWrapper::RangeCursor cursor;
+    const bool has_cursor = params.contains("cursor") && !params["cursor"].get<std::string>().empty();
+    if (has_cursor)
+    {
+        if (!ExcelWrapper::RangeCursor::decode(params["cursor"].get<std::string>(), sheet_name, range, cursor))
         {
-            uint32_t current_col = first_column;
-            for (const auto &cell_value : row)
-            {
-                if (cell_value.type() != OpenXLSX::XLValueType::Empty)
-                {
-                    std::string cell_content_str;
-                    if (cell_value.type() == OpenXLSX::XLValueType::Boolean)
-                    {
-                        cell_content_str = cell_value.get<bool>() ? "TRUE" : "FALSE";
-                    }
-                    else if (cell_value.type() == OpenXLSX::XLValueType::Integer)
-                    {
-                        cell_content_str = std::to_string(cell_value.get<int64_t>());
-                    }
-                    else if (cell_value.type() == OpenXLSX::XLValueType::Float)
-                    {
-                        // Use std::ostringstream for better float formatting if needed
-                        cell_content_str = std::to_string(cell_value.get<double>());
-                    }
-                    else if (cell_value.type() == OpenXLSX::XLValueType::String)
-                    {
-                        cell_content_str = cell_value.get<std::string>();
-                    }
-                    else
-                    { // Consider other types as string for simplicity
-                        try
-                        {
-                            cell_content_str = cell_value.get<std::string>();
-                        }
-                        catch (const OpenXLSX::XLValueTypeError &e)
-                        {
-                            // Handle cases where conversion to string might fail for unexpected types
-                            cell_content_str = i18n::t("result.unsupported_type");
-                            spdlog::warn(i18n::t("log.warn.unsupported_cell_type.get_range", current_row, current_col, e.what()));
-                        }
-                    }
-                    std::string cell_address = s_getCellAddress(current_row, current_col);
-                    result_array.push_back(cell_content_str + "@" + cell_address);
-                }
-                current_col++;
-            }
-            current_row++;
+            LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.invalid_cursor"));
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.invalid_cursor"));
+        }
+        if (page_rows == 0)
+        {
+            page_rows = RANGE_PAGE_DEFAULT_ROWS;
         }
     }
-    else
+    const bool paged = page_rows != 0;
+    const uint32_t page_first_row = has_cursor ? cursor.nextRow : first_row;
+    const uint32_t page_last_row =
+        paged ? static_cast<uint32_t>(std::min<uint64_t>(last_row, uint64_t(page_first_row) + page_rows - 1)) : last_row;
+
+    static mcp::latency_histogram &open_time = s_phaseHistogram("get_sheet_range_content", "open");
+    static mcp::latency_histogram &read_time = s_phaseHistogram("get_sheet_range_content", "read");
+    static mcp::latency_histogram &serialize_time = s_phaseHistogram("get_sheet_range_content", "serialize");
+
+    // Copy the range out of the workbook and release it, so formatting the result does not hold up other calls
+    std::vector<std::vector<OpenXLSX::XLCellValue>> range_values;
+    uint32_t next_row = 0;
+    uint64_t revision = 0;
     {
-        for (const auto &row : range_values)
+        WorkbookCache::Lease excel = ensure_excel_open(session_id, open_time);
+        MCP_TRACE_SCOPE("excel", "ExcelOperator::getRangePage");
+        mcp::scoped_timer timer(read_time);
+        if (has_cursor && cursor.revision != excel.revision())
         {
-            mcp::json row_array = mcp::json::array();
-            for (const auto &cell_value : row)
-            {
-                if (cell_value.type() == OpenXLSX::XLValueType::Empty)
-                {
-                    row_array.push_back(nullptr);
-                }
-                else if (cell_value.type() == OpenXLSX::XLValueType::Boolean)
-                {
-                    row_array.push_back(cell_value.get<bool>());
-                }
-                else if (cell_value.type() == OpenXLSX::XLValueType::Integer)
-                {
-                    row_array.push_back(cell_value.get<int64_t>());
-                }
-                else if (cell_value.type() == OpenXLSX::XLValueType::Float)
-                {
-                    row_array.push_back(cell_value.get<double>());
-                }
-                else
-                { // Treat String and others similarly
-                    try
-                    {
-                        row_array.push_back(cell_value.get<std::string>());
-                    }
-                    catch (const OpenXLSX::XLValueTypeError &e)
-                    {
-                        row_array.push_back(i18n::t("result.unsupported_type"));
-                        // Optionally log the error with row/col if needed, though harder without tracking here
-                        spdlog::warn(i18n::t("log.warn.unsupported_cell_type.standard", e.what()));
-                    }
-                }
-            }
-            result_array.push_back(row_array);
+            LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.cursor_expired"));
+            throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.cursor_expired"));
         }
+        if (!excel->selectSheet(sheet_name))
+        {
+            LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_select_sheet", sheet_name));
+            throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
+        }
+        range_values = excel->getRangePage(page_first_row, first_column, page_last_row, last_column, next_row);
+        revision = excel.revision();
+    }
+
+    ExcelWrapper::RangeSerializer serializer(
+        i18n::t("result.unsupported_type"),
+        [&](size_t row_offset, size_t column_offset, const std::string &error)
+        {
+            LOG_MESSAGE(spdlog::level::warn, i18n::t("log.warn.unsupported_cell_type.get_range", page_first_row + row_offset, first_column + column_offset, error));
+        });
+    std::string text;
+    {
+        MCP_TRACE_SCOPE("excel", "RangeSerializer::serialize");
+        mcp::scoped_timer timer(serialize_time);
+        text = serializer.serialize(format, range_values, page_first_row, first_column);
     }
 
     mcp::json result = {
         {{"type", "text"},
-         {"text", result_array.dump()}}};
-    g_excel_operator.close();
-    spdlog::info(i18n::t("log.info.retrieved_range", sheet_name));
+         {"text", std::move(text)}}};
+    if (paged)
+    {
+        mcp::json page = {
+            {"first_row", page_first_row},
+            {"last_row", page_last_row},
+            {"next_cursor", nullptr}};
+        if (next_row != 0 && next_row <= last_row)
+        {
+            page["next_cursor"] = ExcelWrapper::RangeCursor{revision, next_row, sheet_name}.encode();
+        }
+        result.push_back({{"type", "text"},
+                          {"text", page.dump()}});
+    }
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.retrieved_range", sheet_name));
     return result;
 }
 
-mcp::json create_xlsx_file_handler(const mcp::json &params, const std::string & /* session_id */)
+mcp::json create_xlsx_file_handler(const mcp::json &params, const std::string &session_id)
 {
     if (!params.contains("file_path"))
     {
-        spdlog::error(i18n::t("log.error.missing_params.create_xlsx"));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.create_xlsx"));
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_param.file_path_create"));
     }
 
     std::string file_path = params["file_path"].get<std::string>();
 
-    if (g_excel_operator.create(file_path))
+    static mcp::latency_histogram &create_time = s_phaseHistogram("create_xlsx_file_by_absolute_path", "create");
+    try
     {
-        g_current_excel_file_path = file_path;
-        mcp::json result = {
-            {{"type", "text"},
-             {"text", i18n::t("result.created_excel", file_path)}}};
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.created_excel", file_path));
-        return result;
+        mcp::scoped_timer timer(create_time);
+        WorkbookCache::getInstance().create(file_path);
     }
-    else
+    catch (const std::exception &e)
     {
-        spdlog::error(i18n::t("log.error.failed_create_excel", file_path));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_create_excel", file_path));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_create_excel", file_path));
     }
+
+    s_setCurrentExcelFilePath(session_id, file_path);
+    mcp::json result = {
+        {{"type", "text"},
+         {"text", i18n::t("result.created_excel", file_path)}}};
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.created_excel", file_path));
+    return result;
 }
 
-mcp::json set_sheet_range_content_handler(const mcp::json &params, const std::string & /* session_id */)
+// Converts the JSON 2D array of a 'values' parameter into cell values
+static std::vector<std::vector<OpenXLSX::XLCellValue>> s_parseCellRows(const mcp::json &json_values)
 {
-    ensure_excel_open();
-
-    if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
-        !params.contains("values"))
-    {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.missing_params.set_range"));
-        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.set_range"));
-    }
-
-    std::string sheet_name = params["sheet_name"].get<std::string>();
-    uint32_t first_row = params["first_row"].get<uint32_t>();
-    uint32_t first_column = params["first_column"].get<uint32_t>();
-    mcp::json json_values = params["values"];
-
-    if (!json_values.is_array())
-    {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.values_not_2d_array"));
-        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
-    }
-
-    std::vector<std::vector<OpenXLSX::XLCellValue>> values_to_set;
+    std::vector<std::vector<OpenXLSX::XLCellValue>> rows;
+    rows.reserve(json_values.size());
     for (const auto &row_json : json_values)
     {
         if (!row_json.is_array())
         {
-            g_excel_operator.close();
-            spdlog::error(i18n::t("log.error.values_row_not_array"));
+            LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_row_not_array"));
             throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_row_not_array"));
         }
         std::vector<OpenXLSX::XLCellValue> row_values;
+        row_values.reserve(row_json.size());
         for (const auto &cell_json : row_json)
         {
             if (cell_json.is_boolean())
@@ -329,38 +363,243 @@ mcp::json set_sheet_range_content_handler(const mcp::json &params, const std::st
             }
             else
             {
-                g_excel_operator.close();
-                spdlog::error(i18n::t("log.error.unsupported_cell_type.set_range"));
+                LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.unsupported_cell_type.set_range"));
                 throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.unsupported_cell_type.set_range"));
             }
         }
-        values_to_set.push_back(row_values);
+        rows.push_back(std::move(row_values));
+    }
+    return rows;
+}
+
+// Throws the invalid_params error for a 'values' text that decoder rejected
+static void s_throwDecodeError(const ExcelWrapper::RangeRowDecoder &decoder)
+{
+    if (decoder.error() == ExcelWrapper::RangeRowDecoder::Error::RowNotArray)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_row_not_array"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_row_not_array"));
+    }
+    if (decoder.error() == ExcelWrapper::RangeRowDecoder::Error::UnsupportedValue)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.unsupported_cell_type.set_range"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.unsupported_cell_type.set_range"));
+    }
+    LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_not_2d_array"));
+    throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
+}
+
+// Throws invalid_params if row_count rows of up to column_count values, starting at first_row/first_column, do not
+// fit in a worksheet
+static void s_checkRangeFits(const std::string &sheet_name, uint32_t first_row, uint32_t first_column, size_t row_count,
+                             size_t column_count)
+{
+    if (row_count == 0)
+    {
+        return;
+    }
+    if (first_row < 1 || first_row - 1 + row_count > OpenXLSX::MAX_ROWS || first_column < 1 ||
+        first_column - 1 + column_count > OpenXLSX::MAX_COLS)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_exceed_sheet", sheet_name,
+                                                std::to_string(row_count) + " rows from row " + std::to_string(first_row) + ", " +
+                                                    std::to_string(column_count) + " columns from column " + std::to_string(first_column)));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params,
+                                 i18n::t("exception.error.values_exceed_sheet", OpenXLSX::MAX_ROWS, OpenXLSX::MAX_COLS));
+    }
+}
+
+// Decodes values from its JSON text and writes each row as soon as it is decoded, so neither a JSON document nor
+// the whole range is built in memory. A first pass decodes the text without writing, so that a malformed or too
+// large payload is rejected before the workbook is touched; it costs a second parse but holds only one row.
+static mcp::json s_setRangeFromText(const std::string &session_id, const std::string &sheet_name, uint32_t first_row,
+                                    uint32_t first_column, const mcp::json::binary_t &text)
+{
+    static mcp::latency_histogram &parse_time = s_phaseHistogram("set_sheet_range_content", "parse");
+    static mcp::latency_histogram &open_time = s_phaseHistogram("set_sheet_range_content", "open");
+    static mcp::latency_histogram &write_time = s_phaseHistogram("set_sheet_range_content", "write");
+
+    mcp::scoped_timer parse_timer(parse_time);
+    size_t column_count = 0;
+    ExcelWrapper::RangeRowDecoder validator(
+        [&](const std::vector<OpenXLSX::XLCellValue> &row)
+        {
+            column_count = std::max(column_count, row.size());
+        });
+    if (!validator.decode(text.data(), text.size()))
+    {
+        s_throwDecodeError(validator);
+    }
+    s_checkRangeFits(sheet_name, first_row, first_column, validator.rowCount(), column_count);
+    parse_timer.stop();
+
+    WorkbookCache::Lease excel = ensure_excel_open(session_id, open_time);
+    mcp::scoped_timer timer(write_time); // Decoding and writing are interleaved, so both are recorded as writing
+    if (!excel->selectSheet(sheet_name))
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_select_sheet", sheet_name));
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
+    }
+
+    uint32_t row_number = first_row;
+    bool written = true;
+    ExcelWrapper::RangeRowDecoder decoder(
+        [&](const std::vector<OpenXLSX::XLCellValue> &row)
+        {
+            if (row_number == first_row)
+            {
+                excel.markDirty();
+            }
+            if (written && !excel->setRowValues(row_number, first_column, row))
+            {
+                written = false;
+            }
+            ++row_number;
+        });
+
+    try
+    {
+        if (!decoder.decode(text.data(), text.size()))
+        {
+            s_throwDecodeError(decoder);
+        }
+    }
+    catch (const OpenXLSX::XLCellAddressError &e)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_exceed_sheet", sheet_name, e.what()));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params,
+                                 i18n::t("exception.error.values_exceed_sheet", OpenXLSX::MAX_ROWS, OpenXLSX::MAX_COLS));
+    }
+
+    if (!written)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_set_range", sheet_name));
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_set_range"));
+    }
+
+    mcp::json result = {
+        {{"type", "text"},
+         {"text", i18n::t("result.set_range")}}};
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.set_range", sheet_name));
+    return result;
+}
+
+mcp::json set_sheet_range_content_handler(const mcp::json &params, const std::string &session_id)
+{
+    if (!params.contains("sheet_name") || !params.contains("first_row") || !params.contains("first_column") ||
+        !params.contains("values"))
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.set_range"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.set_range"));
     }
 
-    if (!g_excel_operator.selectSheet(sheet_name))
+    std::string sheet_name = params["sheet_name"].get<std::string>();
+    uint32_t first_row = params["first_row"].get<uint32_t>();
+    uint32_t first_column = params["first_column"].get<uint32_t>();
+    const mcp::json &json_values = params["values"];
+
+    if (!json_values.is_array() && !json_values.is_binary())
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_select_sheet", sheet_name));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_not_2d_array"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
+    }
+
+    // values arrives as its JSON text when the server left it unparsed; see set_raw_argument in s_mcpServer_init
+    if (json_values.is_binary())
+    {
+        return s_setRangeFromText(session_id, sheet_name, first_row, first_column, json_values.get_binary());
+    }
+
+    static mcp::latency_histogram &parse_time = s_phaseHistogram("set_sheet_range_content", "parse");
+    static mcp::latency_histogram &open_time = s_phaseHistogram("set_sheet_range_content", "open");
+    static mcp::latency_histogram &write_time = s_phaseHistogram("set_sheet_range_content", "write");
+
+    mcp::scoped_timer parse_timer(parse_time);
+    std::vector<std::vector<OpenXLSX::XLCellValue>> values_to_set = s_parseCellRows(json_values);
+    size_t column_count = 0;
+    for (const auto &row : values_to_set)
+    {
+        column_count = std::max(column_count, row.size());
+    }
+    s_checkRangeFits(sheet_name, first_row, first_column, values_to_set.size(), column_count);
+    parse_timer.stop();
+
+    WorkbookCache::Lease excel = ensure_excel_open(session_id, open_time);
+    mcp::scoped_timer write_timer(write_time);
+    if (!excel->selectSheet(sheet_name))
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_select_sheet", sheet_name));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
     }
 
-    if (g_excel_operator.setRangeValues(first_row, first_column, values_to_set))
+    if (excel->setRangeValues(first_row, first_column, values_to_set))
     {
+        excel.markDirty();
         mcp::json result = {
             {{"type", "text"},
              {"text", i18n::t("result.set_range")}}};
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.set_range", sheet_name));
+        LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.set_range", sheet_name));
         return result;
     }
     else
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_set_range", sheet_name));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_set_range", sheet_name));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_set_range"));
     }
 }
 
+mcp::json write_sheet_rows_handler(const mcp::json &params, const std::string &session_id)
+{
+    if (!params.contains("sheet_name") || !params.contains("values"))
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.write_rows"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.write_rows"));
+    }
+
+    std::string sheet_name = params["sheet_name"].get<std::string>();
+    bool inline_strings = params.value("inline_strings", false);
+    mcp::json json_values = params["values"];
+
+    if (!json_values.is_array())
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_not_2d_array"));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.values_not_2d_array"));
+    }
+
+    static mcp::latency_histogram &parse_time = s_phaseHistogram("write_sheet_rows", "parse");
+    static mcp::latency_histogram &open_time = s_phaseHistogram("write_sheet_rows", "open");
+    static mcp::latency_histogram &write_time = s_phaseHistogram("write_sheet_rows", "write");
+
+    mcp::scoped_timer parse_timer(parse_time);
+    std::vector<std::vector<OpenXLSX::XLCellValue>> rows = s_parseCellRows(json_values);
+    parse_timer.stop();
+
+    WorkbookCache::Lease excel = ensure_excel_open(session_id, open_time);
+    try
+    {
+        mcp::scoped_timer timer(write_time);
+        excel->writeSheetRows(sheet_name, rows, inline_strings);
+    }
+    catch (const OpenXLSX::XLInputError &e)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.values_exceed_sheet", sheet_name, e.what()));
+        throw mcp::mcp_exception(mcp::error_code::invalid_params,
+                                 i18n::t("exception.error.values_exceed_sheet", OpenXLSX::MAX_ROWS, OpenXLSX::MAX_COLS));
+    }
+    catch (const std::exception &e)
+    {
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_write_rows", sheet_name, e.what()));
+        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_write_rows", e.what()));
+    }
+
+    excel.markDirty();
+    mcp::json result = {
+        {{"type", "text"},
+         {"text", i18n::t("result.write_rows", rows.size())}}};
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.write_rows", sheet_name, rows.size()));
+    return result;
+}
+
 // Helper function to convert hex color string to RGB components
 static std::tuple<uint8_t, uint8_t, uint8_t> s_hexToRgb(const std::string &hex)
 {
@@ -430,14 +669,11 @@ static std::pair<uint32_t, uint32_t> s_cellAddressToRowCol(const std::string &ad
     }
 }
 
-mcp::json set_cells_by_array_handler(const mcp::json &params, const std::string & /* session_id */)
+mcp::json set_cells_by_array_handler(const mcp::json &params, const std::string &session_id)
 {
-    ensure_excel_open();
-
     if (!params.contains("sheet_name") || !params.contains("cells"))
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.missing_params.set_cells"));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.missing_params.set_cells"));
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.missing_params.set_cells"));
     }
 
@@ -446,15 +682,18 @@ mcp::json set_cells_by_array_handler(const mcp::json &params, const std::string
 
     if (!cells_json.is_array())
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.cells_not_array"));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.cells_not_array"));
         throw mcp::mcp_exception(mcp::error_code::invalid_params, i18n::t("exception.error.cells_not_array"));
     }
 
-    if (!g_excel_operator.selectSheet(sheet_name))
+    static mcp::latency_histogram &open_time = s_phaseHistogram("set_cells_by_array", "open");
+    static mcp::latency_histogram &write_time = s_phaseHistogram("set_cells_by_array", "write");
+
+    WorkbookCache::Lease excel = ensure_excel_open(session_id, open_time);
+    mcp::scoped_timer write_timer(write_time);
+    if (!excel->selectSheet(sheet_name))
     {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_select_sheet", sheet_name));
+        LOG_MESSAGE(spdlog::level::err, i18n::t("log.error.failed_select_sheet", sheet_name));
         throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_select_sheet", sheet_name));
     }
 
@@ -464,7 +703,7 @@ mcp::json set_cells_by_array_handler(const mcp::json &params, const std::string
             continue;
         std::string instruction = cell_instruction_json.get<std::string>();
 
-        spdlog::info(i18n::t("log.info.instruction", instruction));
+        LOG_MESSAGE(spdlog::level::debug, i18n::t("log.info.instruction", instruction));
 
         std::string content;
         std::string address;
@@ -514,94 +753,129 @@ mcp::json set_cells_by_array_handler(const mcp::json &params, const std::string
         auto [row, col] = s_cellAddressToRowCol(address);
         if (row == 0 || col == 0)
         {
-            spdlog::warn(i18n::t("log.warn.invalid_cell_address", address));
+            LOG_MESSAGE(spdlog::level::warn, i18n::t("log.warn.invalid_cell_address", address));
             continue;
         }
 
         // 1. Set content
         if (content_end != std::string::npos)
         {
-            g_excel_operator.setCellValue(address, content);
+            excel->setCellValue(address, content);
         }
 
-        // 2. Set style
+        // 2. Set style and colors, composed into one change. Markers later in this order win, as before.
+        ExcelWrapper::CellStyleChange style_change;
         if (!style.empty())
         {
-            spdlog::info(i18n::t("log.info.setting_cell_style", address, style));
+            LOG_MESSAGE(spdlog::level::debug, i18n::t("log.info.setting_cell_style", address, style));
             // Alignment
             if (style.find("➡️") != std::string::npos)
-                g_excel_operator.setCellAlignment(row, col, "right", "");
+                style_change.horizontalAlignment = OpenXLSX::XLAlignRight;
             if (style.find("⬅️") != std::string::npos)
-                g_excel_operator.setCellAlignment(row, col, "left", "");
+                style_change.horizontalAlignment = OpenXLSX::XLAlignLeft;
             if (style.find("↔️") != std::string::npos)
-                g_excel_operator.setCellAlignment(row, col, "center", "");
+                style_change.horizontalAlignment = OpenXLSX::XLAlignCenter;
             // Font style
             if (style.find('B') != std::string::npos)
-                g_excel_operator.setCellFontBold(row, col, true);
+                style_change.bold = true;
             if (style.find('b') != std::string::npos)
-                g_excel_operator.setCellFontBold(row, col, false);
+                style_change.bold = false;
             if (style.find('I') != std::string::npos)
-                g_excel_operator.setCellFontItalic(row, col, true);
+                style_change.italic = true;
             if (style.find('i') != std::string::npos)
-                g_excel_operator.setCellFontItalic(row, col, false);
+                style_change.italic = false;
             if (style.find('U') != std::string::npos)
-                g_excel_operator.setCellFontUnderline(row, col, true);
+                style_change.underline = true;
             if (style.find('u') != std::string::npos)
-                g_excel_operator.setCellFontUnderline(row, col, false);
+                style_change.underline = false;
         }
 
-        // 3. Set foreground color
+        // 3. Foreground color
         if (!fg_color.empty())
         {
             auto [r, g, b] = s_hexToRgb(fg_color);
-            g_excel_operator.setCellFontColor(row, col, r, g, b);
+            style_change.fontColor = OpenXLSX::XLColor(r, g, b);
         }
 
-        // 4. Set background color
+        // 4. Background color
         if (!bg_color.empty())
         {
             auto [r, g, b] = s_hexToRgb(bg_color);
-            g_excel_operator.setCellBackgroundColor(row, col, r, g, b);
+            style_change.backgroundColor = OpenXLSX::XLColor(r, g, b);
         }
-    }
 
-    if (g_excel_operator.save())
-    {
-        mcp::json result = {
-            {{"type", "text"},
-             {"text", i18n::t("result.set_cells_by_array")}}};
-        g_excel_operator.close();
-        spdlog::info(i18n::t("log.info.set_cells_by_array", sheet_name));
-        return result;
-    }
-    else
-    {
-        g_excel_operator.close();
-        spdlog::error(i18n::t("log.error.failed_set_cells_by_array", sheet_name));
-        throw mcp::mcp_exception(mcp::error_code::internal_error, i18n::t("exception.error.failed_set_cells_by_array"));
+        if (!style_change.empty())
+        {
+            excel->setCellStyle(row, col, style_change);
+        }
     }
+
+    excel.markDirty();
+    mcp::json result = {
+        {{"type", "text"},
+         {"text", i18n::t("result.set_cells_by_array")}}};
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.set_cells_by_array", sheet_name));
+    return result;
 }
 
 static void s_spdlog_init()
 {
-
+    spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+    auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    auto logger = std::make_shared<spdlog::async_logger>("ExcelAutoCpp", console_sink, spdlog::thread_pool(),
+                                                         spdlog::async_overflow_policy::overrun_oldest);
+    spdlog::set_default_logger(logger);
     spdlog::set_pattern("%^%L%$(%H:%M:%S) %v");
+    spdlog::set_level(spdlog::level::info);
+    spdlog::cfg::load_env_levels(LOG_LEVEL_ENV);
 
-    bool console_sink_exists = false;
-    for (const auto &sink : spdlog::default_logger()->sinks())
+    std::chrono::milliseconds flush_interval = LOG_FLUSH_INTERVAL;
+    if (const char *flush_ms = std::getenv(LOG_FLUSH_INTERVAL_ENV))
     {
-        if (std::dynamic_pointer_cast<spdlog::sinks::stdout_color_sink_mt>(sink))
+        try
         {
-            console_sink_exists = true;
-            break;
+            flush_interval = std::chrono::milliseconds(std::stoul(flush_ms));
+        }
+        catch (const std::exception &)
+        {
+            spdlog::warn("Ignoring invalid {} '{}'.", LOG_FLUSH_INTERVAL_ENV, flush_ms);
         }
     }
+    spdlog::flush_every(flush_interval);
+    spdlog::flush_on(spdlog::level::err);
 
-    if (!console_sink_exists)
+    // The MCP library logs through the same queue. It stays at errors only unless debug output was asked for.
+    mcp::set_log_level(logger->should_log(spdlog::level::debug) ? mcp::log_level::debug : mcp::log_level::error);
+    mcp::set_log_sink(
+        [](mcp::log_level level, const std::string &message)
+        {
+            static const spdlog::level::level_enum LEVELS[] = {spdlog::level::debug, spdlog::level::info,
+                                                               spdlog::level::warn, spdlog::level::err};
+            spdlog::log(LEVELS[static_cast<int>(level)], "{}", message);
+        });
+}
+
+static OpenXLSX::XLCompressionLevel s_saveCompressionLevel()
+{
+    const char *level = std::getenv(SAVE_COMPRESSION_LEVEL_ENV);
+    if (!level)
+    {
+        return SAVE_COMPRESSION_LEVEL;
+    }
+    static const std::pair<const char *, OpenXLSX::XLCompressionLevel> LEVELS[] = {
+        {"store", OpenXLSX::XLCompressionLevel::Store},
+        {"fast", OpenXLSX::XLCompressionLevel::Fast},
+        {"default", OpenXLSX::XLCompressionLevel::Default},
+        {"max", OpenXLSX::XLCompressionLevel::Max}};
+    for (const auto &[name, value] : LEVELS)
     {
-        auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
-        spdlog::default_logger()->sinks().push_back(console_sink);
+        if (std::strcmp(level, name) == 0)
+        {
+            return value;
+        }
     }
+    spdlog::warn("Ignoring invalid {} '{}'.", SAVE_COMPRESSION_LEVEL_ENV, level);
+    return SAVE_COMPRESSION_LEVEL;
 }
 
 static void s_mcpServer_init(mcp::server &server, bool blocking_mode)
@@ -609,14 +883,31 @@ static void s_mcpServer_init(mcp::server &server, bool blocking_mode)
     server.set_server_info("ExcelAutoCpp", "1.0.0"); // Server name/version likely not translated
 
     mcp::json capabilities = {
-        {"tools", mcp::json::object()}};
+        {"tools", mcp::json::object()},
+        {"resources", mcp::json::object()}};
     server.set_capabilities(capabilities);
 
+    mcp::metrics::instance().describe("excel_tool_phase_seconds", "Time spent in each phase of a tool call");
+    server.set_metrics_endpoint(METRICS_ENDPOINT);
+    server.register_resource(METRICS_RESOURCE_URI, std::make_shared<mcp::metrics_resource>(METRICS_RESOURCE_URI));
+#ifdef MCP_ENABLE_TRACING
+    server.set_trace_endpoint(TRACE_ENDPOINT);
+#endif
+#ifdef OPENXLSX_ENABLE_TRACING
+    OpenXLSX::setTraceSink(
+        [](const char *name, const std::string &detail, std::chrono::steady_clock::time_point start,
+           std::chrono::steady_clock::time_point end)
+        {
+            mcp::trace_buffer::instance().record("openxlsx", name, detail, start, end);
+        });
+#endif
+
     mcp::tool open_excel_tool = mcp::tool_builder("open_excel_and_list_sheets")
                                     .with_description(i18n::t("tool.open_excel.description"))
                                     .with_string_param("file_path", i18n::t("tool.open_excel.param.file_path"))
                                     .build();
     server.register_tool(open_excel_tool, open_excel_and_list_sheets_handler);
+    server.register_session_cleanup("current_workbook", s_clearCurrentExcelFilePath);
 
     mcp::tool get_range_tool = mcp::tool_builder("get_sheet_range_content")
                                    .with_description(i18n::t("tool.get_range.description"))
@@ -626,6 +917,9 @@ static void s_mcpServer_init(mcp::server &server, bool blocking_mode)
                                    .with_number_param("last_row", i18n::t("tool.get_range.param.last_row"))
                                    .with_number_param("last_column", i18n::t("tool.get_range.param.last_column"))
                                    .with_boolean_param("cell_with_coord", i18n::t("tool.get_range.param.cell_with_coord")) // Note: Key was 'seperate_cell' in code, 'cell_with_coord' in JSON
+                                   .with_string_param("format", i18n::t("tool.get_range.param.format"), false)
+                                   .with_number_param("page_rows", i18n::t("tool.get_range.param.page_rows"), false)
+                                   .with_string_param("cursor", i18n::t("tool.get_range.param.cursor"), false)
                                    .build();
     server.register_tool(get_range_tool, get_sheet_range_content_handler);
 
@@ -637,6 +931,7 @@ static void s_mcpServer_init(mcp::server &server, bool blocking_mode)
                                    .with_array_param("values", i18n::t("tool.set_range.param.values"), "object") // Schema type "object" likely remains untranslated
                                    .build();
     server.register_tool(set_range_tool, set_sheet_range_content_handler);
+    server.set_raw_argument("set_sheet_range_content", "values");
 
     mcp::tool create_xlsx_tool = mcp::tool_builder("create_xlsx_file_by_absolute_path")
                                      .with_description(i18n::t("tool.create_xlsx.description"))
@@ -651,8 +946,16 @@ static void s_mcpServer_init(mcp::server &server, bool blocking_mode)
                                    .build();
     server.register_tool(set_cells_tool, set_cells_by_array_handler);
 
-    spdlog::info(i18n::t("log.info.server_start", SERVER_PORT));
-    spdlog::info(i18n::t("log.info.server_stop_prompt"));
+    mcp::tool write_rows_tool = mcp::tool_builder("write_sheet_rows")
+                                    .with_description(i18n::t("tool.write_rows.description"))
+                                    .with_string_param("sheet_name", i18n::t("tool.write_rows.param.sheet_name"))
+                                    .with_array_param("values", i18n::t("tool.write_rows.param.values"), "object")
+                                    .with_boolean_param("inline_strings", i18n::t("tool.write_rows.param.inline_strings"), false)
+                                    .build();
+    server.register_tool(write_rows_tool, write_sheet_rows_handler);
+
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.server_start", SERVER_PORT));
+    LOG_MESSAGE(spdlog::level::info, i18n::t("log.info.server_stop_prompt"));
 
     server.start(blocking_mode);
 }
@@ -724,14 +1027,31 @@ int main()
 
     std::cout << ASCII_ART << std::endl;
 
-    spdlog::set_level(spdlog::level::info);
     s_spdlog_init();
 
     s_i18n_init();
 
+    WorkbookCache::Options cache_options;
+    cache_options.maxWorkbooks = CACHE_MAX_WORKBOOKS;
+    cache_options.memoryBudget = CACHE_MEMORY_BUDGET;
+    cache_options.flushDelay = CACHE_FLUSH_DELAY;
+    cache_options.saveOptions.compressionLevel = s_saveCompressionLevel();
+    cache_options.saveOptions.compressionThreads = SAVE_COMPRESSION_THREADS;
+    WorkbookCache::getInstance().setOptions(cache_options);
+
+    std::signal(SIGINT, s_onStopSignal);
+    std::signal(SIGTERM, s_onStopSignal);
+
     mcp::server server("localhost", SERVER_PORT);
-    mcp::set_log_level(mcp::log_level::error); // Keep MCP library logs concise
-    s_mcpServer_init(server, true);
+    s_mcpServer_init(server, false);
+    while (!g_stop_requested && server.is_running())
+    {
+        std::this_thread::sleep_for(SHUTDOWN_POLL_INTERVAL);
+    }
 
+    spdlog::info("Shutting down, saving pending edits.");
+    server.stop();
+    WorkbookCache::getInstance().shutdown(); // Before spdlog::shutdown, as saving may log
+    spdlog::shutdown();                      // Write out the queued messages
     return 0;
 }
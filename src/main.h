@@ -12,8 +12,14 @@
 #include <filesystem>
 #include <algorithm>
 #include <spdlog/spdlog.h> // Include spdlog header
+#include <spdlog/async.h>
+#include <spdlog/cfg/env.h>
 #include <spdlog/sinks/stdout_color_sinks.h> // Include console color output sink
 
 #include "ExcelOperator.h"
+#include "RangeRowDecoder.h"
+#include "RangeSerializer.h"
+#include "SheetRange.h"
+#include "WorkbookCache.h"
 
 #endif //_MAIN_H_
\ No newline at end of file
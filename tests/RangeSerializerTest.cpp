@@ -0,0 +1,28 @@
+// Escaping of cell text in the get_sheet_range_content output formats.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "RangeSerializer.h"
+
+using ExcelWrapper::RangeSerializer;
+using OpenXLSX::XLCellValue;
+
+namespace {
+
+TEST(RangeSerializerTest, MarkdownEscapesDelimitersInCellText)
+{
+    RangeSerializer serializer("?");
+    RangeSerializer::Rows rows = {
+        {XLCellValue(std::string("C:\\temp\\")), XLCellValue(std::string("a|b"))},
+        {XLCellValue(std::string("line 1\r\nline 2")), XLCellValue(int64_t(7))}};
+
+    EXPECT_EQ(serializer.toMarkdown(rows, 1, 1),
+              "|  | A | B |\n"
+              "|---|---|---|\n"
+              "| 1 | C:\\\\temp\\\\ | a\\|b |\n"
+              "| 2 | line 1<br>line 2 | 7 |\n");
+}
+
+} // namespace
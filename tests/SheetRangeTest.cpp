@@ -0,0 +1,105 @@
+// Range and cursor checks of get_sheet_range_content, which sizes its result by the requested range.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ExcelOperator.h"
+#include "SheetRange.h"
+
+using ExcelWrapper::ExcelOperator;
+using ExcelWrapper::RangeCursor;
+using ExcelWrapper::SheetRange;
+
+namespace {
+
+TEST(SheetRangeTest, RangeMustLieWithinTheWorksheet)
+{
+    EXPECT_TRUE((SheetRange{1, 1, 1, 1}.isValid()));
+    EXPECT_TRUE((SheetRange{1, 1, OpenXLSX::MAX_ROWS, OpenXLSX::MAX_COLS}.isValid()));
+
+    EXPECT_FALSE((SheetRange{0, 1, 10, 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 0, 10, 1}.isValid()));
+    EXPECT_FALSE((SheetRange{5, 1, 4, 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 5, 1, 4}.isValid()));
+}
+
+TEST(SheetRangeTest, RejectsLastRowBeyondTheWorksheet)
+{
+    EXPECT_FALSE((SheetRange{1, 1, OpenXLSX::MAX_ROWS + 1, 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 1, 2000000, 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 1, std::numeric_limits<uint32_t>::max(), 1}.isValid()));
+}
+
+TEST(SheetRangeTest, RejectsLastColumnBeyondTheWorksheet)
+{
+    EXPECT_FALSE((SheetRange{1, 1, 1, OpenXLSX::MAX_COLS + 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 1, 1, 65536 + 1}.isValid()));
+    EXPECT_FALSE((SheetRange{1, 1, 1, std::numeric_limits<uint32_t>::max()}.isValid()));
+}
+
+TEST(SheetRangeTest, CursorRoundTripsWithinItsRange)
+{
+    const SheetRange range{1, 1, 5000, 3};
+    RangeCursor cursor;
+    ASSERT_TRUE(RangeCursor::decode(RangeCursor{42, 1001, "Sheet1"}.encode(), "Sheet1", range, cursor));
+    EXPECT_EQ(cursor.revision, 42u);
+    EXPECT_EQ(cursor.nextRow, 1001u);
+    EXPECT_EQ(cursor.sheetName, "Sheet1");
+
+    EXPECT_FALSE(RangeCursor::decode(RangeCursor{42, 1001, "Sheet1"}.encode(), "Sheet2", range, cursor));
+    EXPECT_FALSE(RangeCursor::decode(RangeCursor{42, 5001, "Sheet1"}.encode(), "Sheet1", range, cursor));
+    EXPECT_FALSE(RangeCursor::decode("not a cursor", "Sheet1", range, cursor));
+}
+
+TEST(SheetRangeTest, CursorIsRejectedAgainstARangeBeyondTheWorksheet)
+{
+    // Paging must not let a client walk past the worksheet one page at a time
+    const std::string encoded = RangeCursor{42, 1001, "Sheet1"}.encode();
+    RangeCursor cursor;
+    EXPECT_FALSE(RangeCursor::decode(encoded, "Sheet1", SheetRange{1, 1, std::numeric_limits<uint32_t>::max(), 3}, cursor));
+    EXPECT_FALSE(RangeCursor::decode(encoded, "Sheet1", SheetRange{1, 1, 5000, OpenXLSX::MAX_COLS + 1}, cursor));
+
+    const SheetRange wholeSheet{1, 1, OpenXLSX::MAX_ROWS, 1};
+    EXPECT_FALSE(RangeCursor::decode(RangeCursor{42, OpenXLSX::MAX_ROWS + 1, "Sheet1"}.encode(), "Sheet1", wholeSheet, cursor));
+    // "42:4294967297:Sheet1", a row that would wrap around to row 1 as a uint32_t
+    EXPECT_FALSE(RangeCursor::decode("34323a343239343936373239373a536865657431", "Sheet1", wholeSheet, cursor));
+}
+
+TEST(SheetRangeTest, ReadingBeyondTheWorksheetThrows)
+{
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "ExcelAutoCppSheetRangeTest";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const std::string file = (dir / "range.xlsx").string();
+
+    {
+        ExcelOperator excel;
+        ASSERT_TRUE(excel.create(file));
+        ASSERT_TRUE(excel.selectSheet("Sheet1"));
+        excel.setCellValue("A1", std::string("only row"));
+        ASSERT_TRUE(excel.save());
+    }
+
+    // A reopened sheet is streamed, a sheet that was written to is read from its loaded rows
+    ExcelOperator excel;
+    std::vector<std::string> sheetNames;
+    ASSERT_TRUE(excel.open(file, sheetNames));
+    ASSERT_TRUE(excel.selectSheet("Sheet1"));
+    EXPECT_THROW(excel.getRangeValues(1, 1, std::numeric_limits<uint32_t>::max(), 1), OpenXLSX::XLCellAddressError);
+    EXPECT_THROW(excel.getRangeValues(1, 1, 1, OpenXLSX::MAX_COLS + 1), OpenXLSX::XLCellAddressError);
+
+    excel.setCellValue("B1", std::string("loaded"));
+    EXPECT_THROW(excel.getRangeValues(1, 1, std::numeric_limits<uint32_t>::max(), 1), OpenXLSX::XLCellAddressError);
+    EXPECT_THROW(excel.getRangeValues(1, 1, 1, 65536 + 1), OpenXLSX::XLCellAddressError);
+    EXPECT_EQ(excel.getRangeValues(1, 1, 1, 2).size(), 1u);
+
+    excel.close();
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace
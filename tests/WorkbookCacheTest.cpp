@@ -0,0 +1,76 @@
+// WorkbookCache behaviour that tool calls rely on, on workbooks in a temporary directory.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "WorkbookCache.h"
+
+using ExcelWrapper::ExcelOperator;
+using ExcelWrapper::WorkbookCache;
+
+namespace {
+
+class WorkbookCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        m_dir = std::filesystem::temp_directory_path() / "ExcelAutoCppWorkbookCacheTest";
+        std::filesystem::remove_all(m_dir);
+        std::filesystem::create_directories(m_dir);
+
+        // One resident workbook, and no background saves during the test
+        WorkbookCache::Options options;
+        options.maxWorkbooks = 1;
+        options.flushDelay = std::chrono::hours(1);
+        WorkbookCache::getInstance().setOptions(options);
+    }
+
+    void TearDown() override
+    {
+        WorkbookCache::getInstance().flushAll();
+        std::filesystem::remove_all(m_dir);
+    }
+
+    std::filesystem::path m_dir;
+};
+
+TEST_F(WorkbookCacheTest, WorkbookThatFailsToSaveSurvivesEviction)
+{
+    WorkbookCache& cache = WorkbookCache::getInstance();
+    const std::filesystem::path editedDir = m_dir / "edited";
+    const std::string edited = (editedDir / "edited.xlsx").string();
+    const std::string other = (m_dir / "other.xlsx").string();
+    std::filesystem::create_directories(editedDir);
+
+    {
+        WorkbookCache::Lease lease = cache.create(edited);
+        ASSERT_TRUE(lease->selectSheet("Sheet1"));
+        lease->setCellValue("A1", std::string("unsaved edit"));
+        lease.markDirty();
+    }
+
+    // Saving fails while the directory is missing, so evicting the workbook would lose the edit
+    std::filesystem::remove_all(editedDir);
+    cache.create(other);
+
+    {
+        WorkbookCache::Lease lease = cache.acquire(edited);
+        ASSERT_TRUE(lease->selectSheet("Sheet1"));
+        EXPECT_EQ(lease->getCellValue<std::string>("A1"), "unsaved edit");
+    }
+
+    std::filesystem::create_directories(editedDir);
+    cache.flushAll();
+
+    ExcelOperator reopened;
+    std::vector<std::string> sheetNames;
+    ASSERT_TRUE(reopened.open(edited, sheetNames));
+    ASSERT_TRUE(reopened.selectSheet("Sheet1"));
+    EXPECT_EQ(reopened.getCellValue<std::string>("A1"), "unsaved edit");
+}
+
+} // namespace